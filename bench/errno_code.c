@@ -0,0 +1,114 @@
+/**
+ * @brief
+ * Looks up the code of every errno name errnoname(1) returns
+ * on this platform, and of a few names it does not know,
+ * two ways:
+ *
+ *      linear: every code from 1 up, errnoname(1) & strcmp(3)
+ *              until the name matches, how the code was found
+ *              before viwerr_errno_code(1).
+ *      hash:   viwerr_errno_code(1), one hash & one strcmp(3).
+ */
+#define REMOVE_ERRNO_REDEFINE
+#include "../viwerr.h"
+#include <time.h>
+
+#define BENCH_ROUNDS 20000
+#define BENCH_CODES  4096
+#define BENCH_NAMES  (BENCH_CODES + 4)
+
+static double
+bench_now(
+        void )
+{
+
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+
+}
+
+/**
+ * @brief
+ * Highest code errnoname(1) has a name for, the linear
+ * search gives up after it.
+ */
+static int bench_max_code = 0;
+
+#ifdef __GNUC__
+__attribute__((noinline))
+#endif
+static int
+bench_linear(
+        const char * name )
+{
+
+        int code;
+        for( code = 1; code <= bench_max_code; code++ ) {
+                const char *known = errnoname(code);
+                if( known != NULL && !strcmp(known, name) ) {
+                        return code;
+                }
+        }
+        return 0;
+
+}
+
+int
+main(
+        void )
+{
+
+        static const char *names[BENCH_NAMES];
+        size_t amount = 0;
+        int code;
+
+        for( code = 1; code < BENCH_CODES; code++ ) {
+                const char *name = errnoname(code);
+                if( name != NULL && name[0] != '\0' ) {
+                        names[amount++] = name;
+                        bench_max_code  = code;
+                }
+        }
+        names[amount++] = "EFOO";
+        names[amount++] = "ENOTANERROR";
+        names[amount++] = "E";
+        names[amount++] = "ZZZ";
+
+        /**
+         * @brief
+         * Both ways have to agree before they are timed.
+         */
+        size_t i;
+        for( i = 0; i < amount; i++ ) {
+                if( bench_linear(names[i]) != viwerr_errno_code(names[i]) ) {
+                        fprintf(stderr, "bench/errno_code: %s differs\n",
+                                names[i]);
+                        return 1;
+                }
+        }
+
+        volatile int sink = 0;
+        long round;
+
+        double start = bench_now();
+        for( round = 0; round < BENCH_ROUNDS; round++ )
+                for( i = 0; i < amount; i++ )
+                        sink += bench_linear(names[i]);
+        double linear = (bench_now() - start) / (BENCH_ROUNDS * amount);
+
+        start = bench_now();
+        for( round = 0; round < BENCH_ROUNDS; round++ )
+                for( i = 0; i < amount; i++ )
+                        sink += viwerr_errno_code(names[i]);
+        double hash = (bench_now() - start) / (BENCH_ROUNDS * amount);
+
+        printf("bench/errno_code: %zu names, codes up to %d\n",
+                amount, bench_max_code);
+        printf("  linear %8.2f ns/lookup\n", linear);
+        printf("  hash   %8.2f ns/lookup\n", hash);
+
+        (void)sink;
+        return 0;
+
+}
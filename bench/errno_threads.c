@@ -0,0 +1,204 @@
+/**
+ * @brief
+ * Calls the errno hook, viwerr_errno_redefine(3), from
+ * 1, 2, 4... threads at once, every thread with its own
+ * errno value, and compares it with the hook viwerr had
+ * before its state was thread local (reproduced below).
+ *
+ *      shared: every call writes the same static struct, the
+ *              threads fight over its cache line & compare
+ *              their errno with the value of another thread,
+ *              each mismatch would have been a push.
+ *      local:  viwerr_errno_redefine(3), nothing is shared.
+ *
+ * Build with make bench THREAD_SAFE=1 (or THREAD_RINGS=1),
+ * the single threaded library only runs with one thread.
+ */
+#define REMOVE_ERRNO_REDEFINE
+#include "../viwerr.h"
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_CALLS   2000000
+#define BENCH_THREADS 64
+
+static volatile struct {
+
+        int code;
+        char * func;
+        char * file;
+        int line;
+
+} bench_previous;
+
+static pthread_barrier_t bench_barrier;
+
+typedef struct bench_thread_st {
+
+        pthread_t thread;
+        int       code;
+        bool      shared;
+        double    time;
+        long      spurious;
+
+} bench_thread;
+
+static double
+bench_now(
+        void )
+{
+
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+
+}
+
+/**
+ * @brief
+ * viwerr_errno_redefine(3) with a process wide @b previous,
+ * counting the pushes instead of pushing. Not inlined,
+ * like the library call it is compared with.
+ */
+#ifdef __GNUC__
+__attribute__((noinline))
+#endif
+static long
+bench_shared_hook(
+        char * func,
+        const char * file,
+        int line )
+{
+
+        long spurious = 0;
+
+        if( errno != 0 && errno != bench_previous.code ) {
+                spurious = 1;
+        }
+
+        bench_previous.code = errno;
+        bench_previous.file = (char*)file;
+        bench_previous.func = func;
+        bench_previous.line = line;
+        return spurious;
+
+}
+
+static void *
+bench_run(
+        void * pointer )
+{
+
+        bench_thread *thread = (bench_thread*)pointer;
+        long i;
+
+        errno = thread->code;
+
+        /**
+         * @brief
+         * The first call sees errno change from 0 & pushes,
+         * leave it out of the measurement.
+         */
+        viwerr_errno_redefine((char*)__func__, __FILE__, __LINE__);
+        bench_shared_hook((char*)__func__, __FILE__, __LINE__);
+
+        pthread_barrier_wait(&bench_barrier);
+        double start = bench_now();
+
+        if( thread->shared == true ) {
+                for( i = 0; i < BENCH_CALLS; i++ )
+                        thread->spurious += bench_shared_hook(
+                                (char*)__func__, __FILE__, __LINE__
+                        );
+        } else {
+                for( i = 0; i < BENCH_CALLS; i++ )
+                        viwerr_errno_redefine(
+                                (char*)__func__, __FILE__, __LINE__
+                        );
+        }
+
+        thread->time = bench_now() - start;
+        return NULL;
+
+}
+
+static void
+bench_round(
+        int threads,
+        bool shared,
+        double * ns,
+        long * spurious )
+{
+
+        bench_thread thread[BENCH_THREADS];
+        int i;
+
+        pthread_barrier_init(&bench_barrier, NULL, (unsigned)threads);
+
+        for( i = 0; i < threads; i++ ) {
+
+                thread[i].code     = 1 + i % 30;
+                thread[i].shared   = shared;
+                thread[i].time     = 0;
+                thread[i].spurious = 0;
+                pthread_create(&thread[i].thread, NULL, bench_run, &thread[i]);
+
+        }
+
+        *ns = 0;
+        *spurious = 0;
+        for( i = 0; i < threads; i++ ) {
+
+                pthread_join(thread[i].thread, NULL);
+                *ns += thread[i].time / BENCH_CALLS;
+                *spurious += thread[i].spurious;
+
+        }
+        *ns /= threads;
+
+        pthread_barrier_destroy(&bench_barrier);
+
+}
+
+int
+main(
+        void )
+{
+
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        int max = 1;
+
+#ifdef VIWERR_THREAD_SAFE
+        while( max * 2 <= cpus * 2 && max * 2 <= BENCH_THREADS ) {
+                max *= 2;
+        }
+#endif
+
+        printf("bench/errno_threads: %d calls per thread, %ld cpus\n",
+                BENCH_CALLS, cpus);
+
+        int threads;
+        for( threads = 1; threads <= max; threads *= 2 ) {
+
+                double shared_ns, local_ns;
+                long   shared_spurious, local_spurious;
+
+                bench_round(threads, true,  &shared_ns, &shared_spurious);
+                bench_round(threads, false, &local_ns,  &local_spurious);
+
+                printf("  %2d threads  shared %7.2f ns/call"
+                       " (%ld spurious pushes)  local %7.2f ns/call\n",
+                        threads, shared_ns, shared_spurious, local_ns);
+
+        }
+
+        /**
+         * @brief
+         * Every thread pushed its errno value once.
+         */
+        viwerr(VIWERR_FLUSH|VIWERR_NO_ERRNO_TRIGGER, NULL);
+        return 0;
+
+}
@@ -0,0 +1,226 @@
+/**
+ * @brief
+ * Compares the package ring layout viwerr used at first
+ * (1 + VIWERR_PACKAGE_AMOUNT * 6 allocations) with a single
+ * block of slots that hold the package & its buffers, and
+ * with the structure of arrays _viwerr_ring_alloc(2) uses.
+ *
+ *      startup: time to allocate, initalize & free a ring.
+ *      scan:    time to walk the ring reading the flags of every
+ *               package, like an unfiltered VIWERR_OCCURED does
+ *               on an empty ring, after the cache was trashed.
+ *               The legacy ring has an unrelated block held
+ *               after every package.
+ */
+#define REMOVE_ERRNO_REDEFINE
+#include "../viwerr.h"
+#include <time.h>
+
+#define BENCH_ROUNDS 2000
+#define BENCH_TRASH  (size_t)(8 << 20)
+#define BENCH_FILLER 256
+
+typedef struct bench_slot_st {
+
+        viwerr_package package;
+        char name[VIWERR_NAME_SIZE];
+        char message[VIWERR_MESSAGE_SIZE];
+        char group[VIWERR_GROUP_SIZE];
+        char file[VIWERR_FILENAME_SIZE];
+        char func[VIWERR_FUNCTION_SIZE];
+
+} bench_slot;
+
+static double
+bench_now(
+        void )
+{
+
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+
+}
+
+static void
+bench_trash_cache(
+        volatile char * trash )
+{
+
+        size_t i;
+        for( i = 0; i < BENCH_TRASH; i += 64 )
+                trash[i]++;
+
+}
+
+/**
+ * @brief
+ * With @b filler every package is followed by a block of
+ * BENCH_FILLER bytes that is held until legacy_free(2), so
+ * the packages & their buffers end up scattered like they
+ * would in a program that has been running for a while.
+ */
+static viwerr_package **
+legacy_init(
+        void ** filler )
+{
+
+        viwerr_package **array = malloc(
+                sizeof(viwerr_package*) * VIWERR_PACKAGE_AMOUNT
+        );
+
+        size_t i;
+        for( i = 0; i < VIWERR_PACKAGE_AMOUNT; i++ ) {
+
+                array[i] = malloc(sizeof(viwerr_package));
+                *array[i] = viwerr_package_empty;
+                array[i]->name    = calloc(VIWERR_NAME_SIZE, 1);
+                array[i]->message = calloc(VIWERR_MESSAGE_SIZE, 1);
+                array[i]->group   = calloc(VIWERR_GROUP_SIZE, 1);
+                array[i]->file    = calloc(VIWERR_FILENAME_SIZE, 1);
+                array[i]->func    = calloc(VIWERR_FUNCTION_SIZE, 1);
+
+                if( filler != NULL )
+                        filler[i] = malloc(BENCH_FILLER);
+
+        }
+
+        return array;
+
+}
+
+static void
+legacy_free(
+        viwerr_package ** array,
+        void **           filler )
+{
+
+        size_t i;
+        for( i = 0; i < VIWERR_PACKAGE_AMOUNT; i++ ) {
+
+                if( filler != NULL )
+                        free(filler[i]);
+
+                free(array[i]->name);
+                free(array[i]->message);
+                free(array[i]->group);
+                free(array[i]->file);
+                free(array[i]->func);
+                free(array[i]);
+
+        }
+        free(array);
+
+}
+
+static bench_slot *
+slab_init(
+        void )
+{
+
+        bench_slot *array = malloc(
+                sizeof(bench_slot) * VIWERR_PACKAGE_AMOUNT
+        );
+
+        size_t i;
+        for( i = 0; i < VIWERR_PACKAGE_AMOUNT; i++ ) {
+
+                array[i].name[0] = array[i].message[0] =
+                array[i].group[0] = array[i].file[0] =
+                array[i].func[0] = '\0';
+                array[i].package = viwerr_package_empty;
+                array[i].package.name    = array[i].name;
+                array[i].package.message = array[i].message;
+                array[i].package.group   = array[i].group;
+                array[i].package.file    = array[i].file;
+                array[i].package.func    = array[i].func;
+
+        }
+
+        return array;
+
+}
+
+int
+main(
+        void )
+{
+
+        volatile char *trash = calloc(BENCH_TRASH, 1);
+        volatile long sink = 0;
+        double start, legacy_startup, slab_startup, soa_startup;
+        double legacy_scan = 0, slab_scan = 0, soa_scan = 0;
+        int round;
+        size_t i;
+
+        start = bench_now();
+        for( round = 0; round < BENCH_ROUNDS; round++ )
+                legacy_free(legacy_init(NULL), NULL);
+        legacy_startup = (bench_now() - start) / BENCH_ROUNDS;
+
+        start = bench_now();
+        for( round = 0; round < BENCH_ROUNDS; round++ )
+                free(slab_init());
+        slab_startup = (bench_now() - start) / BENCH_ROUNDS;
+
+        _viwerr_ring soa;
+
+        start = bench_now();
+        for( round = 0; round < BENCH_ROUNDS; round++ ) {
+                _viwerr_ring_alloc(&soa, VIWERR_PACKAGE_AMOUNT);
+                free(soa.block);
+        }
+        soa_startup = (bench_now() - start) / BENCH_ROUNDS;
+
+        /**
+         * @brief
+         * Only the scanned legacy ring is scattered, startup
+         * above times the allocations of the ring alone.
+         */
+        void *filler[VIWERR_PACKAGE_AMOUNT];
+        viwerr_package **legacy = legacy_init(filler);
+        bench_slot *slab = slab_init();
+        _viwerr_ring_alloc(&soa, VIWERR_PACKAGE_AMOUNT);
+
+        for( round = 0; round < BENCH_ROUNDS / 20; round++ ) {
+
+                bench_trash_cache(trash);
+                start = bench_now();
+                for( i = 0; i < VIWERR_PACKAGE_AMOUNT; i++ )
+                        sink += legacy[i]->flag.contains
+                              + legacy[i]->flag.returned;
+                legacy_scan += bench_now() - start;
+
+                bench_trash_cache(trash);
+                start = bench_now();
+                for( i = 0; i < VIWERR_PACKAGE_AMOUNT; i++ )
+                        sink += slab[i].package.flag.contains
+                              + slab[i].package.flag.returned;
+                slab_scan += bench_now() - start;
+
+                bench_trash_cache(trash);
+                start = bench_now();
+                for( i = 0; i < VIWERR_PACKAGE_AMOUNT; i++ )
+                        sink += VIWERR_STATE_PENDING(soa.state[i]);
+                soa_scan += bench_now() - start;
+
+        }
+
+        legacy_free(legacy, filler);
+        free(slab);
+        free(soa.block);
+        free((void*)trash);
+
+        printf("bench/slab: %zu packages\n", VIWERR_PACKAGE_AMOUNT);
+        printf("  startup   legacy %10.1f ns  slab %10.1f ns"
+               "  soa %10.1f ns\n",
+                legacy_startup, slab_startup, soa_startup);
+        printf("  cold scan legacy %10.1f ns  slab %10.1f ns"
+               "  soa %10.1f ns\n",
+                legacy_scan / (BENCH_ROUNDS / 20),
+                slab_scan / (BENCH_ROUNDS / 20),
+                soa_scan / (BENCH_ROUNDS / 20));
+
+        return sink == 42;
+
+}
@@ -0,0 +1,104 @@
+#define VIWERR_REMOVE_FOR_OBJ_COMP
+#include "../viwerr.h"
+size_t
+_viwerr_pop_batch(
+        int             arg,
+        char*           func,
+        const char *    file,
+        int             line,
+        viwerr_filter * filter,
+        viwerr_package *packages,
+        viwerr_buffers *buffers,
+        size_t          amount )
+{
+
+        if( (packages == NULL || buffers == NULL) && amount != 0 ) {
+
+                fprintf(stderr,
+                "viwerr_pop_batch: expected non NULL"
+                " \"packages\" & \"buffers\" arrays for"
+                " %zu packages.\n"
+                " File: %s \n"
+                " Line: %d \n"
+                "viwerr file fprintf called at:\n"
+                " %d : %s\n",
+                amount, file, line,__LINE__,__FILE__
+                );
+                return 0;
+
+        }
+
+        _viwerr_errno_trigger(arg, func, file, line);
+
+        VIWERR_LOCK();
+
+        _viwerr_ring *ring = _viwerr_list_init();
+
+        /**
+         * @brief
+         * Repeated VIWERR_POP calls with the same filter
+         * return the matches newest first and each one
+         * continues from where the previous one stopped,
+         * so the whole batch is one walk of the live bitmap.
+         */
+        size_t popped = 0;
+        size_t walked = 0;
+        size_t index  = ring->newest;
+
+        while( popped < amount
+        &&     ring->amount != 0
+        &&     walked < ring->capacity ) {
+
+                walked += _viwerr_live_prev(
+                        ring,
+                        (ring->newest - walked) & ring->mask,
+                        ring->capacity - walked
+                );
+
+                if( walked >= ring->capacity ) {
+                        break;
+                }
+
+                size_t at = (ring->newest - walked) & ring->mask;
+                walked++;
+
+                if( filter != NULL
+                && !_viwerr_filter_by(file, line, ring, at, filter) ) {
+                        continue;
+                }
+
+                if( arg & VIWERR_PRINT ) {
+
+                        ring->state[at] |= VIWERR_STATE_PRINTED;
+                        fprintf(stderr, "\nviwerr: an exception was caught!");
+                        _viwerr_print_package(
+                                _viwerr_package_view(ring, at)
+                        );
+
+                }
+
+                ring->state[at] |= VIWERR_STATE_RETURNED;
+                _viwerr_live_set(ring, at, false);
+                _viwerr_package_copy_into(
+                        ring, _viwerr_package_view(ring, at),
+                        &packages[popped], &buffers[popped]
+                );
+                popped++;
+                index = at;
+
+        }
+
+        /**
+         * @brief
+         * Leave the ring the way the last VIWERR_POP
+         * of the batch would have.
+         */
+        if( popped != 0 ) {
+                ring->newest = ring->amount == 0 ?
+                        0 : (index - 1) & ring->mask;
+        }
+
+        VIWERR_UNLOCK();
+        return popped;
+
+}
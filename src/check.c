@@ -0,0 +1,38 @@
+#define VIWERR_REMOVE_FOR_OBJ_COMP
+#include "../viwerr.h"
+bool
+_viwerr_check_failed(
+        char*        func,
+        const char * file,
+        int          line )
+{
+
+        int code = errno;
+        int arg  = VIWERR_PUSH|VIWERR_NO_ERRNO_TRIGGER|VIWERR_STATIC_LOCATION;
+
+        char const *message = _viwerr_errno_message(code);
+        if( message != NULL ) {
+                arg |= VIWERR_STATIC_MESSAGE;
+        } else {
+                message = _viwerr_errno_strerror(code);
+        }
+
+        /**
+         * @brief
+         * The push may change errno on its way, put it back
+         * the way the failed call left it.
+         */
+        viwerr_file(
+                arg, func, file, line, &(viwerr_package){
+                        .code    = code,
+                        .name    = (char*)errnoname(code),
+                        .message = (char*)message,
+                        .group   = (char*)"errno"
+                }
+        );
+        _viwerr_errno_previous.code = code;
+
+        errno = code;
+        return true;
+
+}
@@ -1,46 +1,54 @@
 #include "../viwerr.h"
 void _viwerr_clear_package( 
-        viwerr_package * package )
+        _viwerr_ring * ring,
+        size_t index )
 {
         
 
-        if( package != NULL ){
-
-                package->code = viwerr_package_empty.code;
-
-                package->line = viwerr_package_empty.line;
-
-                snprintf(package->name, VIWERR_NAME_SIZE, 
-                        "%s",
-                        viwerr_package_empty.name == NULL ? 
-                                "" : viwerr_package_empty.name
-                );
-                  
-                snprintf(package->message, VIWERR_MESSAGE_SIZE, 
-                        "%s",
-                        viwerr_package_empty.message == NULL ? 
-                                "" : viwerr_package_empty.message
-                );
-
-                snprintf(package->group, VIWERR_GROUP_SIZE,
-                        "%s",
-                        viwerr_package_empty.group == NULL ? 
-                                "" : viwerr_package_empty.group
-                );
-
-                snprintf(package->file, VIWERR_FILENAME_SIZE, 
-                        "%s",
-                        viwerr_package_empty.file == NULL ? 
-                                "" : viwerr_package_empty.file
-                );
-
-                package->flag.returned = 
-                        viwerr_package_empty.flag.returned;
-                package->flag.printed  = 
-                        viwerr_package_empty.flag.printed;
-                package->flag.contains = 
-                        viwerr_package_empty.flag.contains;
+        if( ring != NULL ){
+
+                _viwerr_buffers * buffers = &ring->buffers[index];
+
+                /**
+                 * @brief
+                 * Unlink from the code index while the code
+                 * of the slot is still the one it was linked by.
+                 */
+                _viwerr_live_set(ring, index, false);
+
+                ring->code[index] = viwerr_package_empty.code;
+
+                ring->line[index] = viwerr_package_empty.line;
+
+                /**
+                 * @brief
+                 * Interned strings are shared between slots,
+                 * point back at our own buffers before
+                 * emptying them.
+                 */
+                ring->name_id[index]  = 0;
+                ring->group_id[index] = 0;
+                ring->thread[index]   = 0;
+
+                ring->name_hash[index]    = VIWERR_HASH_EMPTY;
+                ring->message_hash[index] = VIWERR_HASH_EMPTY;
+                ring->group_hash[index]   = VIWERR_HASH_EMPTY;
+
+                buffers->name[0]    = '\0';
+                buffers->message[0] = '\0';
+                buffers->group[0]   = '\0';
+                buffers->file[0]    = '\0';
+                buffers->func[0]    = '\0';
+
+                ring->name[index]    = buffers->name;
+                ring->message[index] = buffers->message;
+                ring->group[index]   = buffers->group;
+                ring->file[index]    = buffers->file;
+                ring->func[index]    = buffers->func;
+
+                ring->state[index] =
+                        VIWERR_STATE_RETURNED|VIWERR_STATE_PRINTED;
 
         }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,66 @@
+#include "../viwerr.h"
+bool
+viwerr_configure(
+        viwerr_config * config )
+{
+
+        if( config == NULL ) {
+
+                fprintf(stderr,
+                        "viwerr_configure: expected a NON NULL"
+                        " viwerr_config pointer.\n"
+                        "viwerr file fprintf called at:\n"
+                        " %d : %s\n",
+                        __LINE__, __FILE__
+                );
+                return false;
+
+        }
+
+        VIWERR_LOCK();
+
+        _viwerr_ring *ring = _viwerr_list_init();
+
+        /**
+         * @brief
+         * Round the capacities up to a power of two so
+         * the ring can wrap its indexes with a mask.
+         */
+        size_t capacity = config->capacity == 0 ?
+                ring->capacity : VIWERR_PACKAGE_AMOUNT_MIN;
+        while( capacity < config->capacity
+        &&     capacity < ((size_t)-1 >> 1) ) {
+                capacity <<= 1;
+        }
+
+        size_t max_capacity = 0;
+        if( config->grow == true ) {
+
+                max_capacity = ((size_t)-1 >> 1) / VIWERR_SLOT_SIZE;
+                if( config->max_capacity != 0
+                &&  config->max_capacity < max_capacity ) {
+                        max_capacity = config->max_capacity;
+                }
+
+                size_t limit = capacity;
+                while( limit <= max_capacity >> 1 ) {
+                        limit <<= 1;
+                }
+                max_capacity = limit;
+
+        }
+
+        bool resized = capacity == ring->capacity
+                    || _viwerr_ring_resize(ring, capacity);
+
+        if( resized == true ) {
+                ring->max_capacity = max_capacity;
+#ifdef VIWERR_THREAD_RINGS
+                _viwerr_threads_configure(capacity, max_capacity);
+#endif
+        }
+
+        VIWERR_UNLOCK();
+        return resized;
+
+}
@@ -1,12 +1,19 @@
+#define _POSIX_C_SOURCE 200809L
 #define REMOVE_ERRNO_REDEFINE
 #include "../viwerr.h"
 #include <errno.h>
 #include <stdbool.h>
+#include <string.h>
 
 bool viwerr_errno_ignore_new(
         bool set )
 {
-        static bool __set = false;
+        /**
+         * @brief
+         * errno is per thread, so is everything that
+         * remembers what it was.
+         */
+        static VIWERR_THREAD_LOCAL bool __set = false;
         if(set){
 
                 __set = true;
@@ -22,25 +29,64 @@ bool viwerr_errno_ignore_new(
         return false;
 }
 
+bool _viwerr_errno_explicit = false;
+
+bool
+viwerr_errno_explicit(
+        bool set )
+{
+
+        bool previous = _viwerr_errno_explicit;
+        _viwerr_errno_explicit = set;
+        return previous;
+
+}
+
+VIWERR_THREAD_LOCAL _viwerr_errno_state _viwerr_errno_previous = {
+        .code = 0,
+        .func = (char*)"",
+        .file = (char*)"",
+        .line = 0
+};
+
+char const * _viwerr_errno_strerror(
+        int code )
+{
+
+        static VIWERR_THREAD_LOCAL struct {
+
+                bool    cached;
+                int     code;
+                char    message[VIWERR_MESSAGE_SIZE];
+
+        } last = { .cached = false };
+
+        if( last.cached == true && last.code == code ) {
+                return last.message;
+        }
+
+        /**
+         * @brief
+         * The XSI strerror_r(3) fills the buffer, unknown
+         * codes may fail without writing to it.
+         */
+        if( strerror_r(code, last.message, VIWERR_MESSAGE_SIZE) != 0 ) {
+                snprintf(last.message, VIWERR_MESSAGE_SIZE,
+                        "Unknown error %d", code);
+        }
+        last.code   = code;
+        last.cached = true;
+        return last.message;
+
+}
+
 int * viwerr_errno_redefine(
         char*        func,
         const char * file,
         int line )
 {
 
-        static struct {
-
-                int code;
-                char * func;
-                char * file;
-                int line;
-
-        } previous = {
-                .code = 0,
-                .func = (char*)"",
-                .file = (char*)"",
-                .line = 0
-        };
+        _viwerr_errno_state *previous = &_viwerr_errno_previous;
 
         /**
          * @brief @b IMPORTANT
@@ -57,28 +103,35 @@ int * viwerr_errno_redefine(
          * either for reading or writing.
          */
         if(errno == 0
-        || errno == previous.code) {
+        || errno == previous->code) {
 
-                previous.code = errno;
-                previous.file = (char*)file;
-                previous.func = func;
-                previous.line = line;
+                previous->code = errno;
+                previous->file = (char*)file;
+                previous->func = func;
+                previous->line = line;
                 return &errno;
 
         }
 
         if(viwerr_errno_ignore_new(false) != true){
-                viwerr_file(VIWERR_PUSH|VIWERR_NO_ERRNO_TRIGGER,
-                (char*)previous.func, previous.file, previous.line, &(viwerr_package){
+                int arg = VIWERR_PUSH|VIWERR_NO_ERRNO_TRIGGER|VIWERR_STATIC_LOCATION;
+                char const *message = _viwerr_errno_message(errno);
+                if(message != NULL)
+                        arg |= VIWERR_STATIC_MESSAGE;
+                else
+                        message = _viwerr_errno_strerror(errno);
+                viwerr_file(arg,
+                (char*)previous->func, previous->file, previous->line, &(viwerr_package){
                         .code = errno,
                         .name = (char*)errnoname(errno),
-                        .message = strerror(errno),
+                        .message = (char*)message,
                         .group = (char*)"errno"
                 });
         }
-        previous.code = errno;
-        previous.file = (char*)file;
-        previous.line = line;
+        previous->code = errno;
+        previous->file = (char*)file;
+        previous->func = func;
+        previous->line = line;
         return &errno;
 
 }
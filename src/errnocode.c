@@ -0,0 +1,1059 @@
+#include <string.h>
+#include "../viwerr.h"
+
+/**
+ * @brief
+ * Perfect hash over every name errnoname(1) knows, the
+ * name of a package hashed with _viwerr_hash(3) picks a
+ * displacement with its low bits & the displacement picks
+ * the slot from its high bits, no two names share a slot.
+ * Names the platform does not define leave their slot
+ * empty.
+ *
+ * Both tables are generated by tools/errnocode.c, after
+ * names are added to errnoname.c run make errnocode, make
+ * check-errnocode fails while they are out of date.
+ */
+#define _VIWERR_ERRNO_CODE_BUCKETS 64
+#define _VIWERR_ERRNO_CODE_BITS    9
+
+static const unsigned char _viwerr_errno_code_displacement[
+        _VIWERR_ERRNO_CODE_BUCKETS
+] = {
+        38, 10, 25,  4,  5,  0,  3,  7,  5,  0,  4, 22,  1,  6, 28, 12,
+        16,  4,  1, 11,  2, 17,  2, 13,  4,  3,  6,  5, 23, 14,  3, 16,
+        24, 41, 13,  4,  3, 36,  4,  4, 21,  7,  2,  8,  1, 20, 20, 11,
+        15, 17,  1,  8,  1,  3,  2,  8,  1,  3,  6,  1,  0,  4,  9,  0
+};
+
+static const struct {
+
+        const char *name;
+        int         code;
+
+} _viwerr_errno_code_slots[1 << _VIWERR_ERRNO_CODE_BITS] = {
+#ifdef EADDRINUSE
+        [0] = { "EADDRINUSE", EADDRINUSE },
+#endif
+#ifdef ENODEV
+        [1] = { "ENODEV", ENODEV },
+#endif
+#ifdef EMVSWLMERROR
+        [2] = { "EMVSWLMERROR", EMVSWLMERROR },
+#endif
+#ifdef ECHILD
+        [4] = { "ECHILD", ECHILD },
+#endif
+#ifdef EIBMINVTSRBUSERDATA
+        [5] = { "EIBMINVTSRBUSERDATA", EIBMINVTSRBUSERDATA },
+#endif
+#ifdef ERESTARTNOINTR
+        [6] = { "ERESTARTNOINTR", ERESTARTNOINTR },
+#endif
+#ifdef EBADOBJ
+        [7] = { "EBADOBJ", EBADOBJ },
+#endif
+#ifdef EDIRTY
+        [8] = { "EDIRTY", EDIRTY },
+#endif
+#ifdef ECONNREFUSED
+        [9] = { "ECONNREFUSED", ECONNREFUSED },
+#endif
+#ifdef EAI_OVERFLOW
+        [10] = { "EAI_OVERFLOW", EAI_OVERFLOW },
+#endif
+#ifdef ESRVRFAULT
+        [11] = { "ESRVRFAULT", ESRVRFAULT },
+#endif
+#ifdef EDOM
+        [12] = { "EDOM", EDOM },
+#endif
+#ifdef EINVALIDRXSOCKETCALL
+        [13] = { "EINVALIDRXSOCKETCALL", EINVALIDRXSOCKETCALL },
+#endif
+#ifdef ENMFILE
+        [16] = { "ENMFILE", ENMFILE },
+#endif
+#ifdef ENOPOLICY
+        [17] = { "ENOPOLICY", ENOPOLICY },
+#endif
+#ifdef EMAXSOCKETSREACHED
+        [18] = { "EMAXSOCKETSREACHED", EMAXSOCKETSREACHED },
+#endif
+#ifdef ECVPERORR
+        [20] = { "ECVPERORR", ECVPERORR },
+#endif
+#ifdef EBADTYPE
+        [21] = { "EBADTYPE", EBADTYPE },
+#endif
+#ifdef ENONDP
+        [22] = { "ENONDP", ENONDP },
+#endif
+#ifdef EBADMSG
+        [25] = { "EBADMSG", EBADMSG },
+#endif
+#ifdef EKEEPLOOKING
+        [26] = { "EKEEPLOOKING", EKEEPLOOKING },
+#endif
+#ifdef ECONNRESET
+        [27] = { "ECONNRESET", ECONNRESET },
+#endif
+#ifdef ERFKILL
+        [28] = { "ERFKILL", ERFKILL },
+#endif
+#ifdef EPROBE_DEFER
+        [29] = { "EPROBE_DEFER", EPROBE_DEFER },
+#endif
+#ifdef EFORMAT
+        [30] = { "EFORMAT", EFORMAT },
+#endif
+#ifdef EBADF
+        [32] = { "EBADF", EBADF },
+#endif
+#ifdef EMVSCPLERROR
+        [33] = { "EMVSCPLERROR", EMVSCPLERROR },
+#endif
+#ifdef EPASSTHROUGH
+        [37] = { "EPASSTHROUGH", EPASSTHROUGH },
+#endif
+#ifdef ERPCMISMATCH
+        [38] = { "ERPCMISMATCH", ERPCMISMATCH },
+#endif
+#ifdef ESUBTASKALREADYACTIVE
+        [41] = { "ESUBTASKALREADYACTIVE", ESUBTASKALREADYACTIVE },
+#endif
+#ifdef EIBMBADTCPNAME
+        [43] = { "EIBMBADTCPNAME", EIBMBADTCPNAME },
+#endif
+#ifdef EVERSION
+        [44] = { "EVERSION", EVERSION },
+#endif
+#ifdef EAI_FAMILY
+        [46] = { "EAI_FAMILY", EAI_FAMILY },
+#endif
+#ifdef ESOCKETNOTALLOCATED
+        [47] = { "ESOCKETNOTALLOCATED", ESOCKETNOTALLOCATED },
+#endif
+#ifdef EINVALIDNAME
+        [48] = { "EINVALIDNAME", EINVALIDNAME },
+#endif
+#ifdef EMSGSIZE
+        [51] = { "EMSGSIZE", EMSGSIZE },
+#endif
+#ifdef EIBMUNAUTHORIZEDCALLER
+        [53] = { "EIBMUNAUTHORIZEDCALLER", EIBMUNAUTHORIZEDCALLER },
+#endif
+#ifdef EOUTOFSTATE
+        [54] = { "EOUTOFSTATE", EOUTOFSTATE },
+#endif
+#ifdef ENOSHARE
+        [56] = { "ENOSHARE", ENOSHARE },
+#endif
+#ifdef ECHRNG
+        [57] = { "ECHRNG", ECHRNG },
+#endif
+#ifdef ECLONEME
+        [58] = { "ECLONEME", ECLONEME },
+#endif
+#ifdef EBADE
+        [60] = { "EBADE", EBADE },
+#endif
+#ifdef ERESTART
+        [61] = { "ERESTART", ERESTART },
+#endif
+#ifdef ETERM
+        [65] = { "ETERM", ETERM },
+#endif
+#ifdef ETOOMANYREFS
+        [67] = { "ETOOMANYREFS", ETOOMANYREFS },
+#endif
+#ifdef ENOTSYNC
+        [76] = { "ENOTSYNC", ENOTSYNC },
+#endif
+#ifdef EIBMCONFLICT
+        [77] = { "EIBMCONFLICT", EIBMCONFLICT },
+#endif
+#ifdef ERANGE
+        [78] = { "ERANGE", ERANGE },
+#endif
+#ifdef EDEADLOCK
+        [79] = { "EDEADLOCK", EDEADLOCK },
+#endif
+#ifdef EBADRPC
+        [81] = { "EBADRPC", EBADRPC },
+#endif
+#ifdef ENOEXEC
+        [85] = { "ENOEXEC", ENOEXEC },
+#endif
+#ifdef EDOMAINSERVERFAILURE
+        [86] = { "EDOMAINSERVERFAILURE", EDOMAINSERVERFAILURE },
+#endif
+#ifdef ESHUTDOWN
+        [88] = { "ESHUTDOWN", ESHUTDOWN },
+#endif
+#ifdef ETXTBSY
+        [89] = { "ETXTBSY", ETXTBSY },
+#endif
+#ifdef EAUTH
+        [90] = { "EAUTH", EAUTH },
+#endif
+#ifdef ENOLINK
+        [93] = { "ENOLINK", ENOLINK },
+#endif
+#ifdef EDIRIOCTL
+        [95] = { "EDIRIOCTL", EDIRIOCTL },
+#endif
+#ifdef EDESTADDRREQ
+        [96] = { "EDESTADDRREQ", EDESTADDRREQ },
+#endif
+#ifdef EOWNERDEAD
+        [97] = { "EOWNERDEAD", EOWNERDEAD },
+#endif
+#ifdef ESERVERFAULT
+        [98] = { "ESERVERFAULT", ESERVERFAULT },
+#endif
+#ifdef ENOTSOCK
+        [99] = { "ENOTSOCK", ENOTSOCK },
+#endif
+#ifdef EIBMBADCONNECTIONMATCH
+        [102] = { "EIBMBADCONNECTIONMATCH", EIBMBADCONNECTIONMATCH },
+#endif
+#ifdef EINVAL
+        [104] = { "EINVAL", EINVAL },
+#endif
+#ifdef EMFILE
+        [105] = { "EMFILE", EMFILE },
+#endif
+#ifdef EILSEQ
+        [107] = { "EILSEQ", EILSEQ },
+#endif
+#ifdef ECKSUM
+        [108] = { "ECKSUM", ECKSUM },
+#endif
+#ifdef EAGAIN
+        [109] = { "EAGAIN", EAGAIN },
+#endif
+#ifdef EREMOTEIO
+        [112] = { "EREMOTEIO", EREMOTEIO },
+#endif
+#ifdef EMTIMERS
+        [113] = { "EMTIMERS", EMTIMERS },
+#endif
+#ifdef ENOANO
+        [114] = { "ENOANO", ENOANO },
+#endif
+#ifdef EIPADDRNOTFOUND
+        [115] = { "EIPADDRNOTFOUND", EIPADDRNOTFOUND },
+#endif
+#ifdef EINIT
+        [117] = { "EINIT", EINIT },
+#endif
+#ifdef EAI_BADFLAGS
+        [118] = { "EAI_BADFLAGS", EAI_BADFLAGS },
+#endif
+#ifdef EAI_SERVICE
+        [119] = { "EAI_SERVICE", EAI_SERVICE },
+#endif
+#ifdef EALREADY
+        [122] = { "EALREADY", EALREADY },
+#endif
+#ifdef EMVSPASSWORD
+        [124] = { "EMVSPASSWORD", EMVSPASSWORD },
+#endif
+#ifdef EIDRM
+        [126] = { "EIDRM", EIDRM },
+#endif
+#ifdef ENETDOWN
+        [127] = { "ENETDOWN", ENETDOWN },
+#endif
+#ifdef ENEEDAUTH
+        [129] = { "ENEEDAUTH", ENEEDAUTH },
+#endif
+#ifdef ENOSPC
+        [130] = { "ENOSPC", ENOSPC },
+#endif
+#ifdef ENOGRACE
+        [131] = { "ENOGRACE", ENOGRACE },
+#endif
+#ifdef ENOMEDIUM
+        [133] = { "ENOMEDIUM", ENOMEDIUM },
+#endif
+#ifdef EREFUSED
+        [134] = { "EREFUSED", EREFUSED },
+#endif
+#ifdef ESOFT
+        [135] = { "ESOFT", ESOFT },
+#endif
+#ifdef ELNRNG
+        [136] = { "ELNRNG", ELNRNG },
+#endif
+#ifdef EIBMSELECTEXPOST
+        [137] = { "EIBMSELECTEXPOST", EIBMSELECTEXPOST },
+#endif
+#ifdef EMOVEFD
+        [140] = { "EMOVEFD", EMOVEFD },
+#endif
+#ifdef ENAMETOOLONG
+        [141] = { "ENAMETOOLONG", ENAMETOOLONG },
+#endif
+#ifdef EUNATCH
+        [143] = { "EUNATCH", EUNATCH },
+#endif
+#ifdef ENOSR
+        [144] = { "ENOSR", ENOSR },
+#endif
+#ifdef EQFULL
+        [145] = { "EQFULL", EQFULL },
+#endif
+#ifdef ENFSREMOTE
+        [146] = { "ENFSREMOTE", ENFSREMOTE },
+#endif
+#ifdef EDUPFD
+        [148] = { "EDUPFD", EDUPFD },
+#endif
+#ifdef ESTRPIPE
+        [149] = { "ESTRPIPE", ESTRPIPE },
+#endif
+#ifdef EIBMTERMERROR
+        [150] = { "EIBMTERMERROR", EIBMTERMERROR },
+#endif
+#ifdef EISCONN
+        [151] = { "EISCONN", EISCONN },
+#endif
+#ifdef EMVSDYNALC
+        [153] = { "EMVSDYNALC", EMVSDYNALC },
+#endif
+#ifdef ENOLCK
+        [154] = { "ENOLCK", ENOLCK },
+#endif
+#ifdef EFAULT
+        [155] = { "EFAULT", EFAULT },
+#endif
+#ifdef EPROCUNAVAIL
+        [156] = { "EPROCUNAVAIL", EPROCUNAVAIL },
+#endif
+#ifdef ELOCKUNMAPPED
+        [157] = { "ELOCKUNMAPPED", ELOCKUNMAPPED },
+#endif
+#ifdef ESPIPE
+        [159] = { "ESPIPE", ESPIPE },
+#endif
+#ifdef ENOSYM
+        [161] = { "ENOSYM", ENOSYM },
+#endif
+#ifdef EREMCHG
+        [163] = { "EREMCHG", EREMCHG },
+#endif
+#ifdef ECANCELLED
+        [164] = { "ECANCELLED", ECANCELLED },
+#endif
+#ifdef EAI_AGAIN
+        [165] = { "EAI_AGAIN", EAI_AGAIN },
+#endif
+#ifdef EMVSNOTUP
+        [166] = { "EMVSNOTUP", EMVSNOTUP },
+#endif
+#ifdef EPROTOTYPE
+        [167] = { "EPROTOTYPE", EPROTOTYPE },
+#endif
+#ifdef ECASECLASH
+        [168] = { "ECASECLASH", ECASECLASH },
+#endif
+#ifdef EROFS
+        [169] = { "EROFS", EROFS },
+#endif
+#ifdef ERELOCATED
+        [170] = { "ERELOCATED", ERELOCATED },
+#endif
+#ifdef ERECYCLE
+        [171] = { "ERECYCLE", ERECYCLE },
+#endif
+#ifdef EASYNC
+        [173] = { "EASYNC", EASYNC },
+#endif
+#ifdef EBADCOOKIE
+        [174] = { "EBADCOOKIE", EBADCOOKIE },
+#endif
+#ifdef EMVSCATLG
+        [175] = { "EMVSCATLG", EMVSCATLG },
+#endif
+#ifdef ERELOOKUP
+        [177] = { "ERELOOKUP", ERELOOKUP },
+#endif
+#ifdef ENOTUNIQ
+        [178] = { "ENOTUNIQ", ENOTUNIQ },
+#endif
+#ifdef EJUKEBOX
+        [179] = { "EJUKEBOX", EJUKEBOX },
+#endif
+#ifdef ENONET
+        [180] = { "ENONET", ENONET },
+#endif
+#ifdef EREDRIVEOPEN
+        [186] = { "EREDRIVEOPEN", EREDRIVEOPEN },
+#endif
+#ifdef ESYSERROR
+        [187] = { "ESYSERROR", ESYSERROR },
+#endif
+#ifdef EPFNOSUPPORT
+        [188] = { "EPFNOSUPPORT", EPFNOSUPPORT },
+#endif
+#ifdef EOPENSTALE
+        [189] = { "EOPENSTALE", EOPENSTALE },
+#endif
+#ifdef ECAPMODE
+        [190] = { "ECAPMODE", ECAPMODE },
+#endif
+#ifdef EHWPOISON
+        [192] = { "EHWPOISON", EHWPOISON },
+#endif
+#ifdef EACCES
+        [193] = { "EACCES", EACCES },
+#endif
+#ifdef ETOOSMALL
+        [194] = { "ETOOSMALL", ETOOSMALL },
+#endif
+#ifdef EMVSSAF2ERR
+        [195] = { "EMVSSAF2ERR", EMVSSAF2ERR },
+#endif
+#ifdef EBADFD
+        [197] = { "EBADFD", EBADFD },
+#endif
+#ifdef EDOTDOT
+        [198] = { "EDOTDOT", EDOTDOT },
+#endif
+#ifdef ERELOC
+        [201] = { "ERELOC", ERELOC },
+#endif
+#ifdef EJUSTRETURN
+        [203] = { "EJUSTRETURN", EJUSTRETURN },
+#endif
+#ifdef EKEYREJECTED
+        [207] = { "EKEYREJECTED", EKEYREJECTED },
+#endif
+#ifdef ECVCERORR
+        [209] = { "ECVCERORR", ECVCERORR },
+#endif
+#ifdef EMOUNTEXIT
+        [210] = { "EMOUNTEXIT", EMOUNTEXIT },
+#endif
+#ifdef EIBMINVUSERDATA
+        [213] = { "EIBMINVUSERDATA", EIBMINVUSERDATA },
+#endif
+#ifdef EIBMNOACTIVETCP
+        [214] = { "EIBMNOACTIVETCP", EIBMNOACTIVETCP },
+#endif
+#ifdef ENOTDIR
+        [215] = { "ENOTDIR", ENOTDIR },
+#endif
+#ifdef ESUBTASKINVALID
+        [217] = { "ESUBTASKINVALID", ESUBTASKINVALID },
+#endif
+#ifdef EL3HLT
+        [218] = { "EL3HLT", EL3HLT },
+#endif
+#ifdef ENOMSG
+        [219] = { "ENOMSG", ENOMSG },
+#endif
+#ifdef ENOMOVE
+        [220] = { "ENOMOVE", ENOMOVE },
+#endif
+#ifdef EBADVER
+        [221] = { "EBADVER", EBADVER },
+#endif
+#ifdef EMVSPARM
+        [223] = { "EMVSPARM", EMVSPARM },
+#endif
+#ifdef EINTR
+        [224] = { "EINTR", EINTR },
+#endif
+#ifdef ENOUNLD
+        [225] = { "ENOUNLD", ENOUNLD },
+#endif
+#ifdef ERESTARTSYS
+        [226] = { "ERESTARTSYS", ERESTARTSYS },
+#endif
+#ifdef EWOULDBLOCK
+        [228] = { "EWOULDBLOCK", EWOULDBLOCK },
+#endif
+#ifdef EIBMBADREQUESTCODE
+        [229] = { "EIBMBADREQUESTCODE", EIBMBADREQUESTCODE },
+#endif
+#ifdef ECANCELED
+        [230] = { "ECANCELED", ECANCELED },
+#endif
+#ifdef ENOTCONN
+        [231] = { "ENOTCONN", ENOTCONN },
+#endif
+#ifdef ENOENT
+        [232] = { "ENOENT", ENOENT },
+#endif
+#ifdef ENOIOCTL
+        [233] = { "ENOIOCTL", ENOIOCTL },
+#endif
+#ifdef ERECURSE
+        [235] = { "ERECURSE", ERECURSE },
+#endif
+#ifdef EAIO
+        [236] = { "EAIO", EAIO },
+#endif
+#ifdef ECONFIG
+        [237] = { "ECONFIG", ECONFIG },
+#endif
+#ifdef EIBMINVDELETE
+        [238] = { "EIBMINVDELETE", EIBMINVDELETE },
+#endif
+#ifdef ENOTBLK
+        [241] = { "ENOTBLK", ENOTBLK },
+#endif
+#ifdef ENOMEM
+        [242] = { "ENOMEM", ENOMEM },
+#endif
+#ifdef ECLOSED
+        [243] = { "ECLOSED", ECLOSED },
+#endif
+#ifdef EMULTIHOP
+        [244] = { "EMULTIHOP", EMULTIHOP },
+#endif
+#ifdef EMVSNORTL
+        [245] = { "EMVSNORTL", EMVSNORTL },
+#endif
+#ifdef EBADR
+        [246] = { "EBADR", EBADR },
+#endif
+#ifdef EAI_FAIL
+        [247] = { "EAI_FAIL", EAI_FAIL },
+#endif
+#ifdef ENETRESET
+        [248] = { "ENETRESET", ENETRESET },
+#endif
+#ifdef EMVSINITIAL
+        [249] = { "EMVSINITIAL", EMVSINITIAL },
+#endif
+#ifdef EMVSSAFEXTRERR
+        [250] = { "EMVSSAFEXTRERR", EMVSSAFEXTRERR },
+#endif
+#ifdef ELOOP
+        [251] = { "ELOOP", ELOOP },
+#endif
+#ifdef EL3RST
+        [253] = { "EL3RST", EL3RST },
+#endif
+#ifdef ECORRUPT
+        [255] = { "ECORRUPT", ECORRUPT },
+#endif
+#ifdef EMVSEXPIRE
+        [257] = { "EMVSEXPIRE", EMVSEXPIRE },
+#endif
+#ifdef EDESTADDREQ
+        [260] = { "EDESTADDREQ", EDESTADDREQ },
+#endif
+#ifdef EPATHREMOTE
+        [262] = { "EPATHREMOTE", EPATHREMOTE },
+#endif
+#ifdef EINVALIDCOMBINATION
+        [263] = { "EINVALIDCOMBINATION", EINVALIDCOMBINATION },
+#endif
+#ifdef E2BIG
+        [264] = { "E2BIG", E2BIG },
+#endif
+#ifdef ESUBTASKNOTACTIVE
+        [265] = { "ESUBTASKNOTACTIVE", ESUBTASKNOTACTIVE },
+#endif
+#ifdef ERECALLCONFLICT
+        [266] = { "ERECALLCONFLICT", ERECALLCONFLICT },
+#endif
+#ifdef EADDRNOTAVAIL
+        [268] = { "EADDRNOTAVAIL", EADDRNOTAVAIL },
+#endif
+#ifdef EAI_MEMORY
+        [270] = { "EAI_MEMORY", EAI_MEMORY },
+#endif
+#ifdef EIBMCALLINPROGRESS
+        [271] = { "EIBMCALLINPROGRESS", EIBMCALLINPROGRESS },
+#endif
+#ifdef EBADMACHO
+        [273] = { "EBADMACHO", EBADMACHO },
+#endif
+#ifdef EINTEGRITY
+        [274] = { "EINTEGRITY", EINTEGRITY },
+#endif
+#ifdef ESHLIBVERS
+        [275] = { "ESHLIBVERS", ESHLIBVERS },
+#endif
+#ifdef ENOSTR
+        [277] = { "ENOSTR", ENOSTR },
+#endif
+#ifdef ESTALE
+        [278] = { "ESTALE", ESTALE },
+#endif
+#ifdef EIO
+        [279] = { "EIO", EIO },
+#endif
+#ifdef EBADFSYS
+        [280] = { "EBADFSYS", EBADFSYS },
+#endif
+#ifdef EIOCBQUEUED
+        [281] = { "EIOCBQUEUED", EIOCBQUEUED },
+#endif
+#ifdef EOPCOMPLETE
+        [284] = { "EOPCOMPLETE", EOPCOMPLETE },
+#endif
+#ifdef EL2HLT
+        [286] = { "EL2HLT", EL2HLT },
+#endif
+#ifdef EINTRNODATA
+        [287] = { "EINTRNODATA", EINTRNODATA },
+#endif
+#ifdef EEXIST
+        [288] = { "EEXIST", EEXIST },
+#endif
+#ifdef EMEDIUMTYPE
+        [289] = { "EMEDIUMTYPE", EMEDIUMTYPE },
+#endif
+#ifdef EISNAM
+        [290] = { "EISNAM", EISNAM },
+#endif
+#ifdef EDEADLK
+        [293] = { "EDEADLK", EDEADLK },
+#endif
+#ifdef EADV
+        [294] = { "EADV", EADV },
+#endif
+#ifdef EPROTO
+        [296] = { "EPROTO", EPROTO },
+#endif
+#ifdef ENOTRECOVERABLE
+        [297] = { "ENOTRECOVERABLE", ENOTRECOVERABLE },
+#endif
+#ifdef EFPOS
+        [299] = { "EFPOS", EFPOS },
+#endif
+#ifdef ENOPROTOOPT
+        [300] = { "ENOPROTOOPT", ENOPROTOOPT },
+#endif
+#ifdef ENODATA
+        [301] = { "ENODATA", ENODATA },
+#endif
+#ifdef EIPSEC
+        [302] = { "EIPSEC", EIPSEC },
+#endif
+#ifdef EINVALIDCLIENTID
+        [304] = { "EINVALIDCLIENTID", EINVALIDCLIENTID },
+#endif
+#ifdef ENOTEMPTY
+        [306] = { "ENOTEMPTY", ENOTEMPTY },
+#endif
+#ifdef EXDEV
+        [307] = { "EXDEV", EXDEV },
+#endif
+#ifdef EOPNOTSUPP
+        [308] = { "EOPNOTSUPP", EOPNOTSUPP },
+#endif
+#ifdef ESOCKETNOTDEFINED
+        [311] = { "ESOCKETNOTDEFINED", ESOCKETNOTDEFINED },
+#endif
+#ifdef EFTYPE
+        [312] = { "EFTYPE", EFTYPE },
+#endif
+#ifdef EDEVERR
+        [316] = { "EDEVERR", EDEVERR },
+#endif
+#ifdef EAI_SOCKTYPE
+        [317] = { "EAI_SOCKTYPE", EAI_SOCKTYPE },
+#endif
+#ifdef EMVSPFSFILE
+        [318] = { "EMVSPFSFILE", EMVSPFSFILE },
+#endif
+#ifdef ENOLOAD
+        [319] = { "ENOLOAD", ENOLOAD },
+#endif
+#ifdef ESRCH
+        [320] = { "ESRCH", ESRCH },
+#endif
+#ifdef EHOSTNOTFOUND
+        [321] = { "EHOSTNOTFOUND", EHOSTNOTFOUND },
+#endif
+#ifdef EMORE
+        [322] = { "EMORE", EMORE },
+#endif
+#ifdef EMLINK
+        [323] = { "EMLINK", EMLINK },
+#endif
+#ifdef EBADHANDLE
+        [326] = { "EBADHANDLE", EBADHANDLE },
+#endif
+#ifdef ELIBSCN
+        [327] = { "ELIBSCN", ELIBSCN },
+#endif
+#ifdef ETIME
+        [328] = { "ETIME", ETIME },
+#endif
+#ifdef EAI_NONAME
+        [330] = { "EAI_NONAME", EAI_NONAME },
+#endif
+#ifdef ENMELONG
+        [331] = { "ENMELONG", ENMELONG },
+#endif
+#ifdef EDATALESS
+        [333] = { "EDATALESS", EDATALESS },
+#endif
+#ifdef EPROGMISMATCH
+        [335] = { "EPROGMISMATCH", EPROGMISMATCH },
+#endif
+#ifdef EFBIG
+        [336] = { "EFBIG", EFBIG },
+#endif
+#ifdef EPROTONOSUPPORT
+        [337] = { "EPROTONOSUPPORT", EPROTONOSUPPORT },
+#endif
+#ifdef EIBMINVTCPCONNECTION
+        [339] = { "EIBMINVTCPCONNECTION", EIBMINVTCPCONNECTION },
+#endif
+#ifdef ECONSOLEINTERRUPT
+        [340] = { "ECONSOLEINTERRUPT", ECONSOLEINTERRUPT },
+#endif
+#ifdef EINPROG
+        [341] = { "EINPROG", EINPROG },
+#endif
+#ifdef EIBMSOCKOUTOFRANGE
+        [342] = { "EIBMSOCKOUTOFRANGE", EIBMSOCKOUTOFRANGE },
+#endif
+#ifdef EHOSTDOWN
+        [343] = { "EHOSTDOWN", EHOSTDOWN },
+#endif
+#ifdef ENOUNREG
+        [344] = { "ENOUNREG", ENOUNREG },
+#endif
+#ifdef ENOCONNECT
+        [345] = { "ENOCONNECT", ENOCONNECT },
+#endif
+#ifdef ERESTARTNOHAND
+        [346] = { "ERESTARTNOHAND", ERESTARTNOHAND },
+#endif
+#ifdef EUNKNOWN
+        [347] = { "EUNKNOWN", EUNKNOWN },
+#endif
+#ifdef EPROCLIM
+        [348] = { "EPROCLIM", EPROCLIM },
+#endif
+#ifdef EHOSTUNREACH
+        [352] = { "EHOSTUNREACH", EHOSTUNREACH },
+#endif
+#ifdef EXFULL
+        [353] = { "EXFULL", EXFULL },
+#endif
+#ifdef EBUSY
+        [356] = { "EBUSY", EBUSY },
+#endif
+#ifdef EIBMBADCONNECTIONSTATE
+        [362] = { "EIBMBADCONNECTIONSTATE", EIBMBADCONNECTIONSTATE },
+#endif
+#ifdef ELIBBAD
+        [363] = { "ELIBBAD", ELIBBAD },
+#endif
+#ifdef ENOTSUP
+        [364] = { "ENOTSUP", ENOTSUP },
+#endif
+#ifdef ENOPKG
+        [366] = { "ENOPKG", ENOPKG },
+#endif
+#ifdef EQSUSPENDED
+        [368] = { "EQSUSPENDED", EQSUSPENDED },
+#endif
+#ifdef EPERM
+        [370] = { "EPERM", EPERM },
+#endif
+#ifdef ESOCKTNOSUPPORT
+        [373] = { "ESOCKTNOSUPPORT", ESOCKTNOSUPPORT },
+#endif
+#ifdef EISDIR
+        [374] = { "EISDIR", EISDIR },
+#endif
+#ifdef ENOTACTIVE
+        [375] = { "ENOTACTIVE", ENOTACTIVE },
+#endif
+#ifdef EL2NSYNC
+        [376] = { "EL2NSYNC", EL2NSYNC },
+#endif
+#ifdef ENOTEMPT
+        [377] = { "ENOTEMPT", ENOTEMPT },
+#endif
+#ifdef ENOPARAM
+        [378] = { "ENOPARAM", ENOPARAM },
+#endif
+#ifdef EDUPPKG
+        [379] = { "EDUPPKG", EDUPPKG },
+#endif
+#ifdef ENOMATCH
+        [381] = { "ENOMATCH", ENOMATCH },
+#endif
+#ifdef ENOTRUST
+        [386] = { "ENOTRUST", ENOTRUST },
+#endif
+#ifdef EBADRQC
+        [387] = { "EBADRQC", EBADRQC },
+#endif
+#ifdef ENOTTY
+        [390] = { "ENOTTY", ENOTTY },
+#endif
+#ifdef EAFNOSUPPORT
+        [392] = { "EAFNOSUPPORT", EAFNOSUPPORT },
+#endif
+#ifdef ERREMOTE
+        [393] = { "ERREMOTE", ERREMOTE },
+#endif
+#ifdef EIBMTCPABEND
+        [394] = { "EIBMTCPABEND", EIBMTCPABEND },
+#endif
+#ifdef EPWROFF
+        [395] = { "EPWROFF", EPWROFF },
+#endif
+#ifdef EIBMINVSOCKET
+        [396] = { "EIBMINVSOCKET", EIBMINVSOCKET },
+#endif
+#ifdef ESRMNT
+        [397] = { "ESRMNT", ESRMNT },
+#endif
+#ifdef EMVSERR
+        [398] = { "EMVSERR", EMVSERR },
+#endif
+#ifdef EIBMSOCKINUSE
+        [399] = { "EIBMSOCKINUSE", EIBMSOCKINUSE },
+#endif
+#ifdef ELIBMAX
+        [401] = { "ELIBMAX", ELIBMAX },
+#endif
+#ifdef ENOTCAPABLE
+        [402] = { "ENOTCAPABLE", ENOTCAPABLE },
+#endif
+#ifdef ENOCSI
+        [403] = { "ENOCSI", ENOCSI },
+#endif
+#ifdef EMISSED
+        [404] = { "EMISSED", EMISSED },
+#endif
+#ifdef ELIBACC
+        [405] = { "ELIBACC", ELIBACC },
+#endif
+#ifdef EOVERFLOW
+        [406] = { "EOVERFLOW", EOVERFLOW },
+#endif
+#ifdef EWRPROTECT
+        [407] = { "EWRPROTECT", EWRPROTECT },
+#endif
+#ifdef EUSERS
+        [408] = { "EUSERS", EUSERS },
+#endif
+#ifdef EKEYREVOKED
+        [409] = { "EKEYREVOKED", EKEYREVOKED },
+#endif
+#ifdef EMEDIA
+        [412] = { "EMEDIA", EMEDIA },
+#endif
+#ifdef ENOTSUPP
+        [414] = { "ENOTSUPP", ENOTSUPP },
+#endif
+#ifdef ENOREUSE
+        [416] = { "ENOREUSE", ENOREUSE },
+#endif
+#ifdef EBADARCH
+        [417] = { "EBADARCH", EBADARCH },
+#endif
+#ifdef EBFONT
+        [418] = { "EBFONT", EBFONT },
+#endif
+#ifdef ELIBEXEC
+        [419] = { "ELIBEXEC", ELIBEXEC },
+#endif
+#ifdef EALIGN
+        [422] = { "EALIGN", EALIGN },
+#endif
+#ifdef ENFILE
+        [425] = { "ENFILE", ENFILE },
+#endif
+#ifdef EREMDEV
+        [426] = { "EREMDEV", EREMDEV },
+#endif
+#ifdef EREMOTE
+        [427] = { "EREMOTE", EREMOTE },
+#endif
+#ifdef EADI
+        [429] = { "EADI", EADI },
+#endif
+#ifdef EFSCORRUPTED
+        [430] = { "EFSCORRUPTED", EFSCORRUPTED },
+#endif
+#ifdef EDIST
+        [432] = { "EDIST", EDIST },
+#endif
+#ifdef ECONNABORTED
+        [433] = { "ECONNABORTED", ECONNABORTED },
+#endif
+#ifdef ECONNCLOSED
+        [434] = { "ECONNCLOSED", ECONNCLOSED },
+#endif
+#ifdef EDOOFUS
+        [435] = { "EDOOFUS", EDOOFUS },
+#endif
+#ifdef ECKPT
+        [436] = { "ECKPT", ECKPT },
+#endif
+#ifdef ESECTYPEINVAL
+        [441] = { "ESECTYPEINVAL", ESECTYPEINVAL },
+#endif
+#ifdef ELBIN
+        [443] = { "ELBIN", ELBIN },
+#endif
+#ifdef ENOTREADY
+        [445] = { "ENOTREADY", ENOTREADY },
+#endif
+#ifdef ENIVALIDFILENAME
+        [450] = { "ENIVALIDFILENAME", ENIVALIDFILENAME },
+#endif
+#ifdef ECOMM
+        [453] = { "ECOMM", ECOMM },
+#endif
+#ifdef EUCLEAN
+        [455] = { "EUCLEAN", EUCLEAN },
+#endif
+#ifdef EWRONGFS
+        [457] = { "EWRONGFS", EWRONGFS },
+#endif
+#ifdef ERESTART_RESTARTBLOCK
+        [458] = { "ERESTART_RESTARTBLOCK", ERESTART_RESTARTBLOCK },
+#endif
+#ifdef ENOREG
+        [459] = { "ENOREG", ENOREG },
+#endif
+#ifdef ENOREMOTE
+        [460] = { "ENOREMOTE", ENOREMOTE },
+#endif
+#ifdef ENOIOCTLCMD
+        [461] = { "ENOIOCTLCMD", ENOIOCTLCMD },
+#endif
+#ifdef ENOBUFS
+        [462] = { "ENOBUFS", ENOBUFS },
+#endif
+#ifdef ENAVAIL
+        [463] = { "ENAVAIL", ENAVAIL },
+#endif
+#ifdef EBADEXEC
+        [466] = { "EBADEXEC", EBADEXEC },
+#endif
+#ifdef ELINKED
+        [467] = { "ELINKED", ELINKED },
+#endif
+#ifdef EMVSPFSPERM
+        [468] = { "EMVSPFSPERM", EMVSPFSPERM },
+#endif
+#ifdef EBADSLT
+        [469] = { "EBADSLT", EBADSLT },
+#endif
+#ifdef ECTRLTERM
+        [470] = { "ECTRLTERM", ECTRLTERM },
+#endif
+#ifdef EFRAGS
+        [472] = { "EFRAGS", EFRAGS },
+#endif
+#ifdef ENOTNAM
+        [473] = { "ENOTNAM", ENOTNAM },
+#endif
+#ifdef ESAD
+        [476] = { "ESAD", ESAD },
+#endif
+#ifdef ECANCEL
+        [477] = { "ECANCEL", ECANCEL },
+#endif
+#ifdef EREMOTERELEASE
+        [478] = { "EREMOTERELEASE", EREMOTERELEASE },
+#endif
+#ifdef ENOATTR
+        [479] = { "ENOATTR", ENOATTR },
+#endif
+#ifdef EPIPE
+        [483] = { "EPIPE", EPIPE },
+#endif
+#ifdef EINPROGRESS
+        [484] = { "EINPROGRESS", EINPROGRESS },
+#endif
+#ifdef EPOWERF
+        [486] = { "EPOWERF", EPOWERF },
+#endif
+#ifdef EMVSCVAF
+        [487] = { "EMVSCVAF", EMVSCVAF },
+#endif
+#ifdef EMVSARMERROR
+        [489] = { "EMVSARMERROR", EMVSARMERROR },
+#endif
+#ifdef ENOLIC
+        [491] = { "ENOLIC", ENOLIC },
+#endif
+#ifdef EPROGUNAVAIL
+        [492] = { "EPROGUNAVAIL", EPROGUNAVAIL },
+#endif
+#ifdef ENXIO
+        [493] = { "ENXIO", ENXIO },
+#endif
+#ifdef ETIMEDOUT
+        [495] = { "ETIMEDOUT", ETIMEDOUT },
+#endif
+#ifdef ENOKEY
+        [497] = { "ENOKEY", ENOKEY },
+#endif
+#ifdef ENOSYS
+        [498] = { "ENOSYS", ENOSYS },
+#endif
+#ifdef EFAIL
+        [500] = { "EFAIL", EFAIL },
+#endif
+#ifdef ENETUNREACH
+        [502] = { "ENETUNREACH", ENETUNREACH },
+#endif
+#ifdef EENDIAN
+        [504] = { "EENDIAN", EENDIAN },
+#endif
+#ifdef EDQUOT
+        [505] = { "EDQUOT", EDQUOT },
+#endif
+#ifdef EKEYEXPIRED
+        [506] = { "EKEYEXPIRED", EKEYEXPIRED },
+#endif
+#ifdef ENOPARTNERINFO
+        [507] = { "ENOPARTNERINFO", ENOPARTNERINFO },
+#endif
+#ifdef EIBMCANCELLED
+        [508] = { "EIBMCANCELLED", EIBMCANCELLED },
+#endif
+#ifdef EIBMIUCVERR
+        [510] = { "EIBMIUCVERR", EIBMIUCVERR },
+#endif
+#ifdef ESIGPARM
+        [511] = { "ESIGPARM", ESIGPARM },
+#endif
+};
+
+int
+viwerr_errno_code(
+        const char * name )
+{
+
+        if( name == NULL ) {
+                return 0;
+        }
+
+        uint64_t hash = _viwerr_hash(name, VIWERR_NAME_SIZE, NULL);
+        uint32_t step = 2u * _viwerr_errno_code_displacement[
+                hash & (_VIWERR_ERRNO_CODE_BUCKETS - 1)
+        ] + 1u;
+        uint32_t slot = ((uint32_t)(hash >> 32) * step)
+                      >> (32 - _VIWERR_ERRNO_CODE_BITS);
+
+        if( _viwerr_errno_code_slots[slot].name != NULL
+        && !strcmp(_viwerr_errno_code_slots[slot].name, name) ) {
+                return _viwerr_errno_code_slots[slot].code;
+        }
+
+        return 0;
+
+}
@@ -2100,3 +2100,433 @@ char const * errnoname(int errno_)
     return 0;
 #endif /* ERRNONAME_SAFE_TO_USE_ARRAY */
 }
+
+/*
+ * viwerr: the strerror(3) text of every code errnoname(1)
+ * knows, indexed like names[] so a push can point at it
+ * instead of copying a message. Returns 0 for codes not in
+ * the table, the caller falls back to strerror_r(3).
+ */
+char const * _viwerr_errno_message(int errno_)
+{
+#ifdef ERRNONAME_SAFE_TO_USE_ARRAY
+    static char const * const messages[] =
+    {
+        [0] = 0,
+    #ifdef E2BIG
+        [E2BIG] = "Argument list too long",
+    #endif
+    #ifdef EACCES
+        [EACCES] = "Permission denied",
+    #endif
+    #ifdef EADDRINUSE
+        [EADDRINUSE] = "Address already in use",
+    #endif
+    #ifdef EADDRNOTAVAIL
+        [EADDRNOTAVAIL] = "Cannot assign requested address",
+    #endif
+    #ifdef EADV
+        [EADV] = "Advertise error",
+    #endif
+    #ifdef EAFNOSUPPORT
+        [EAFNOSUPPORT] = "Address family not supported by protocol",
+    #endif
+    #ifdef EAGAIN
+        [EAGAIN] = "Resource temporarily unavailable",
+    #endif
+    #ifdef EALREADY
+        [EALREADY] = "Operation already in progress",
+    #endif
+    #ifdef EBADE
+        [EBADE] = "Invalid exchange",
+    #endif
+    #ifdef EBADF
+        [EBADF] = "Bad file descriptor",
+    #endif
+    #ifdef EBADFD
+        [EBADFD] = "File descriptor in bad state",
+    #endif
+    #ifdef EBADMSG
+        [EBADMSG] = "Bad message",
+    #endif
+    #ifdef EBADR
+        [EBADR] = "Invalid request descriptor",
+    #endif
+    #ifdef EBADRQC
+        [EBADRQC] = "Invalid request code",
+    #endif
+    #ifdef EBADSLT
+        [EBADSLT] = "Invalid slot",
+    #endif
+    #ifdef EBFONT
+        [EBFONT] = "Bad font file format",
+    #endif
+    #ifdef EBUSY
+        [EBUSY] = "Device or resource busy",
+    #endif
+    #ifdef ECANCELED
+        [ECANCELED] = "Operation canceled",
+    #endif
+    #ifdef ECHILD
+        [ECHILD] = "No child processes",
+    #endif
+    #ifdef ECHRNG
+        [ECHRNG] = "Channel number out of range",
+    #endif
+    #ifdef ECOMM
+        [ECOMM] = "Communication error on send",
+    #endif
+    #ifdef ECONNABORTED
+        [ECONNABORTED] = "Software caused connection abort",
+    #endif
+    #ifdef ECONNREFUSED
+        [ECONNREFUSED] = "Connection refused",
+    #endif
+    #ifdef ECONNRESET
+        [ECONNRESET] = "Connection reset by peer",
+    #endif
+    #ifdef EDEADLK
+        [EDEADLK] = "Resource deadlock avoided",
+    #endif
+    #ifdef EDEADLOCK
+        #if !defined(EDEADLK) || EDEADLOCK != EDEADLK
+        [EDEADLOCK] = "Resource deadlock avoided",
+        #endif
+    #endif
+    #ifdef EDESTADDRREQ
+        [EDESTADDRREQ] = "Destination address required",
+    #endif
+    #ifdef EDOM
+        [EDOM] = "Numerical argument out of domain",
+    #endif
+    #ifdef EDOTDOT
+        [EDOTDOT] = "RFS specific error",
+    #endif
+    #ifdef EDQUOT
+        [EDQUOT] = "Disk quota exceeded",
+    #endif
+    #ifdef EEXIST
+        [EEXIST] = "File exists",
+    #endif
+    #ifdef EFAULT
+        [EFAULT] = "Bad address",
+    #endif
+    #ifdef EFBIG
+        [EFBIG] = "File too large",
+    #endif
+    #ifdef EHOSTDOWN
+        [EHOSTDOWN] = "Host is down",
+    #endif
+    #ifdef EHOSTUNREACH
+        [EHOSTUNREACH] = "No route to host",
+    #endif
+    #ifdef EHWPOISON
+        [EHWPOISON] = "Memory page has hardware error",
+    #endif
+    #ifdef EIDRM
+        [EIDRM] = "Identifier removed",
+    #endif
+    #ifdef EILSEQ
+        [EILSEQ] = "Invalid or incomplete multibyte or wide character",
+    #endif
+    #ifdef EINPROGRESS
+        [EINPROGRESS] = "Operation now in progress",
+    #endif
+    #ifdef EINTR
+        [EINTR] = "Interrupted system call",
+    #endif
+    #ifdef EINVAL
+        [EINVAL] = "Invalid argument",
+    #endif
+    #ifdef EIO
+        [EIO] = "Input/output error",
+    #endif
+    #ifdef EISCONN
+        [EISCONN] = "Transport endpoint is already connected",
+    #endif
+    #ifdef EISDIR
+        [EISDIR] = "Is a directory",
+    #endif
+    #ifdef EISNAM
+        [EISNAM] = "Is a named type file",
+    #endif
+    #ifdef EKEYEXPIRED
+        [EKEYEXPIRED] = "Key has expired",
+    #endif
+    #ifdef EKEYREJECTED
+        [EKEYREJECTED] = "Key was rejected by service",
+    #endif
+    #ifdef EKEYREVOKED
+        [EKEYREVOKED] = "Key has been revoked",
+    #endif
+    #ifdef EL2HLT
+        [EL2HLT] = "Level 2 halted",
+    #endif
+    #ifdef EL2NSYNC
+        [EL2NSYNC] = "Level 2 not synchronized",
+    #endif
+    #ifdef EL3HLT
+        [EL3HLT] = "Level 3 halted",
+    #endif
+    #ifdef EL3RST
+        [EL3RST] = "Level 3 reset",
+    #endif
+    #ifdef ELIBACC
+        [ELIBACC] = "Can not access a needed shared library",
+    #endif
+    #ifdef ELIBBAD
+        [ELIBBAD] = "Accessing a corrupted shared library",
+    #endif
+    #ifdef ELIBEXEC
+        [ELIBEXEC] = "Cannot exec a shared library directly",
+    #endif
+    #ifdef ELIBMAX
+        [ELIBMAX] = "Attempting to link in too many shared libraries",
+    #endif
+    #ifdef ELIBSCN
+        [ELIBSCN] = ".lib section in a.out corrupted",
+    #endif
+    #ifdef ELNRNG
+        [ELNRNG] = "Link number out of range",
+    #endif
+    #ifdef ELOOP
+        [ELOOP] = "Too many levels of symbolic links",
+    #endif
+    #ifdef EMEDIUMTYPE
+        [EMEDIUMTYPE] = "Wrong medium type",
+    #endif
+    #ifdef EMFILE
+        [EMFILE] = "Too many open files",
+    #endif
+    #ifdef EMLINK
+        [EMLINK] = "Too many links",
+    #endif
+    #ifdef EMSGSIZE
+        [EMSGSIZE] = "Message too long",
+    #endif
+    #ifdef EMULTIHOP
+        [EMULTIHOP] = "Multihop attempted",
+    #endif
+    #ifdef ENAMETOOLONG
+        [ENAMETOOLONG] = "File name too long",
+    #endif
+    #ifdef ENAVAIL
+        [ENAVAIL] = "No XENIX semaphores available",
+    #endif
+    #ifdef ENETDOWN
+        [ENETDOWN] = "Network is down",
+    #endif
+    #ifdef ENETRESET
+        [ENETRESET] = "Network dropped connection on reset",
+    #endif
+    #ifdef ENETUNREACH
+        [ENETUNREACH] = "Network is unreachable",
+    #endif
+    #ifdef ENFILE
+        [ENFILE] = "Too many open files in system",
+    #endif
+    #ifdef ENOANO
+        [ENOANO] = "No anode",
+    #endif
+    #ifdef ENOBUFS
+        [ENOBUFS] = "No buffer space available",
+    #endif
+    #ifdef ENOCSI
+        [ENOCSI] = "No CSI structure available",
+    #endif
+    #ifdef ENODATA
+        [ENODATA] = "No data available",
+    #endif
+    #ifdef ENODEV
+        [ENODEV] = "No such device",
+    #endif
+    #ifdef ENOENT
+        [ENOENT] = "No such file or directory",
+    #endif
+    #ifdef ENOEXEC
+        [ENOEXEC] = "Exec format error",
+    #endif
+    #ifdef ENOKEY
+        [ENOKEY] = "Required key not available",
+    #endif
+    #ifdef ENOLCK
+        [ENOLCK] = "No locks available",
+    #endif
+    #ifdef ENOLINK
+        [ENOLINK] = "Link has been severed",
+    #endif
+    #ifdef ENOMEDIUM
+        [ENOMEDIUM] = "No medium found",
+    #endif
+    #ifdef ENOMEM
+        [ENOMEM] = "Cannot allocate memory",
+    #endif
+    #ifdef ENOMSG
+        [ENOMSG] = "No message of desired type",
+    #endif
+    #ifdef ENONET
+        [ENONET] = "Machine is not on the network",
+    #endif
+    #ifdef ENOPKG
+        [ENOPKG] = "Package not installed",
+    #endif
+    #ifdef ENOPROTOOPT
+        [ENOPROTOOPT] = "Protocol not available",
+    #endif
+    #ifdef ENOSPC
+        [ENOSPC] = "No space left on device",
+    #endif
+    #ifdef ENOSR
+        [ENOSR] = "Out of streams resources",
+    #endif
+    #ifdef ENOSTR
+        [ENOSTR] = "Device not a stream",
+    #endif
+    #ifdef ENOSYS
+        [ENOSYS] = "Function not implemented",
+    #endif
+    #ifdef ENOTBLK
+        [ENOTBLK] = "Block device required",
+    #endif
+    #ifdef ENOTCONN
+        [ENOTCONN] = "Transport endpoint is not connected",
+    #endif
+    #ifdef ENOTDIR
+        [ENOTDIR] = "Not a directory",
+    #endif
+    #ifdef ENOTEMPTY
+        [ENOTEMPTY] = "Directory not empty",
+    #endif
+    #ifdef ENOTNAM
+        [ENOTNAM] = "Not a XENIX named type file",
+    #endif
+    #ifdef ENOTRECOVERABLE
+        [ENOTRECOVERABLE] = "State not recoverable",
+    #endif
+    #ifdef ENOTSOCK
+        [ENOTSOCK] = "Socket operation on non-socket",
+    #endif
+    #ifdef ENOTSUP
+        [ENOTSUP] = "Operation not supported",
+    #endif
+    #ifdef ENOTTY
+        [ENOTTY] = "Inappropriate ioctl for device",
+    #endif
+    #ifdef ENOTUNIQ
+        [ENOTUNIQ] = "Name not unique on network",
+    #endif
+    #ifdef ENXIO
+        [ENXIO] = "No such device or address",
+    #endif
+    #ifdef EOPNOTSUPP
+        #if !defined(ENOTSUP) || EOPNOTSUPP != ENOTSUP
+        [EOPNOTSUPP] = "Operation not supported",
+        #endif
+    #endif
+    #ifdef EOVERFLOW
+        [EOVERFLOW] = "Value too large for defined data type",
+    #endif
+    #ifdef EOWNERDEAD
+        [EOWNERDEAD] = "Owner died",
+    #endif
+    #ifdef EPERM
+        [EPERM] = "Operation not permitted",
+    #endif
+    #ifdef EPFNOSUPPORT
+        [EPFNOSUPPORT] = "Protocol family not supported",
+    #endif
+    #ifdef EPIPE
+        [EPIPE] = "Broken pipe",
+    #endif
+    #ifdef EPROTO
+        [EPROTO] = "Protocol error",
+    #endif
+    #ifdef EPROTONOSUPPORT
+        [EPROTONOSUPPORT] = "Protocol not supported",
+    #endif
+    #ifdef EPROTOTYPE
+        [EPROTOTYPE] = "Protocol wrong type for socket",
+    #endif
+    #ifdef ERANGE
+        [ERANGE] = "Numerical result out of range",
+    #endif
+    #ifdef EREMCHG
+        [EREMCHG] = "Remote address changed",
+    #endif
+    #ifdef EREMOTE
+        [EREMOTE] = "Object is remote",
+    #endif
+    #ifdef EREMOTEIO
+        [EREMOTEIO] = "Remote I/O error",
+    #endif
+    #ifdef ERESTART
+        [ERESTART] = "Interrupted system call should be restarted",
+    #endif
+    #ifdef ERFKILL
+        [ERFKILL] = "Operation not possible due to RF-kill",
+    #endif
+    #ifdef EROFS
+        [EROFS] = "Read-only file system",
+    #endif
+    #ifdef ESHUTDOWN
+        [ESHUTDOWN] = "Cannot send after transport endpoint shutdown",
+    #endif
+    #ifdef ESOCKTNOSUPPORT
+        [ESOCKTNOSUPPORT] = "Socket type not supported",
+    #endif
+    #ifdef ESPIPE
+        [ESPIPE] = "Illegal seek",
+    #endif
+    #ifdef ESRCH
+        [ESRCH] = "No such process",
+    #endif
+    #ifdef ESRMNT
+        [ESRMNT] = "Srmount error",
+    #endif
+    #ifdef ESTALE
+        [ESTALE] = "Stale file handle",
+    #endif
+    #ifdef ESTRPIPE
+        [ESTRPIPE] = "Streams pipe error",
+    #endif
+    #ifdef ETIME
+        [ETIME] = "Timer expired",
+    #endif
+    #ifdef ETIMEDOUT
+        [ETIMEDOUT] = "Connection timed out",
+    #endif
+    #ifdef ETOOMANYREFS
+        [ETOOMANYREFS] = "Too many references: cannot splice",
+    #endif
+    #ifdef ETXTBSY
+        [ETXTBSY] = "Text file busy",
+    #endif
+    #ifdef EUCLEAN
+        [EUCLEAN] = "Structure needs cleaning",
+    #endif
+    #ifdef EUNATCH
+        [EUNATCH] = "Protocol driver not attached",
+    #endif
+    #ifdef EUSERS
+        [EUSERS] = "Too many users",
+    #endif
+    #ifdef EWOULDBLOCK
+        #if !defined(EAGAIN) || EWOULDBLOCK != EAGAIN
+        [EWOULDBLOCK] = "Resource temporarily unavailable",
+        #endif
+    #endif
+    #ifdef EXDEV
+        [EXDEV] = "Invalid cross-device link",
+    #endif
+    #ifdef EXFULL
+        [EXFULL] = "Exchange full",
+    #endif
+
+    };
+    if(errno_ >= 0 && errno_ < (int)(sizeof(messages) / sizeof(*messages)))
+    {
+        return messages[errno_];
+    }
+#endif /* ERRNONAME_SAFE_TO_USE_ARRAY */
+    return 0;
+}
@@ -1,80 +1,302 @@
 #include "../viwerr.h"
+void
+_viwerr_filter_compile(
+        viwerr_filter * filter,
+        int arg,
+        viwerr_package * package,
+        bool insert )
+{
+
+        filter->arg          = 0;
+        filter->codes        = 0;
+        filter->groups       = 0;
+        filter->name         = "";
+        filter->name_id      = 0;
+        filter->name_hash    = VIWERR_HASH_EMPTY;
+        filter->message      = "";
+        filter->message_hash = VIWERR_HASH_EMPTY;
+
+        if( package == NULL ) {
+                return;
+        }
+
+        filter->arg = arg & (VIWERR_BY_CODE
+                            |VIWERR_BY_NAME
+                            |VIWERR_BY_MESSAGE
+                            |VIWERR_BY_GROUP);
+
+        /**
+         * @brief
+         * Interned strings are pointed at in the table,
+         * so only the ones that could not be interned
+         * have to outlive the filter.
+         */
+        size_t length;
+
+        if( arg & VIWERR_BY_CODE ) {
+                filter->code[filter->codes++] = package->code;
+        }
+
+        if( arg & VIWERR_BY_NAME ) {
+                filter->name = package->name != NULL ?
+                        package->name : "";
+                filter->name_hash = _viwerr_hash(
+                        filter->name, VIWERR_NAME_SIZE, &length
+                );
+                filter->name_id = _viwerr_intern_hashed(
+                        filter->name, length, filter->name_hash, insert
+                );
+                if( filter->name_id != 0 ) {
+                        filter->name = _viwerr_intern_string(
+                                filter->name_id
+                        );
+                }
+        }
+
+        if( arg & VIWERR_BY_MESSAGE ) {
+                filter->message = package->message != NULL ?
+                        package->message : "";
+                filter->message_hash = _viwerr_hash(
+                        filter->message, VIWERR_MESSAGE_SIZE, NULL
+                );
+        }
+
+        if( arg & VIWERR_BY_GROUP ) {
+
+                const char * group = package->group != NULL ?
+                        package->group : "";
+                size_t at = filter->groups++;
+
+                filter->group_hash[at] = _viwerr_hash(
+                        group, VIWERR_GROUP_SIZE, &length
+                );
+                filter->group_id[at] = _viwerr_intern_hashed(
+                        group, length, filter->group_hash[at], insert
+                );
+                filter->group[at] = filter->group_id[at] != 0 ?
+                        _viwerr_intern_string(filter->group_id[at]) :
+                        group;
+
+        }
+
+}
+
 bool
-_viwerr_filter_by(
+viwerr_filter_compile(
+        viwerr_filter * filter,
         int arg,
+        viwerr_package * package )
+{
+
+        if( filter == NULL
+        || (package == NULL && (arg & (VIWERR_BY_CODE
+                                      |VIWERR_BY_NAME
+                                      |VIWERR_BY_MESSAGE
+                                      |VIWERR_BY_GROUP))) ) {
+
+                fprintf(stderr,
+                "viwerr_filter_compile: expected a non NULL"
+                " \"filter\" and a non NULL \"package\" for"
+                " arguments from the VIWERR_BY... family.\n"
+                "viwerr file fprintf called at:\n"
+                " %d : %s\n",
+                __LINE__,__FILE__
+                );
+                return false;
+
+        }
+
+        /**
+         * @brief
+         * Intern the strings, unlike the filters viwerr(...)
+         * compiles for a single call this one is reused and
+         * an id only has to be found once. The table never
+         * forgets a string, so a string that could not be
+         * interned now is never interned by a push later.
+         */
+        VIWERR_LOCK();
+        _viwerr_filter_compile(filter, arg, package, true);
+        VIWERR_UNLOCK();
+        return true;
+
+}
+
+bool
+viwerr_filter_add_code(
+        viwerr_filter * filter,
+        int code )
+{
+
+        if( filter == NULL
+        ||  filter->codes >= VIWERR_FILTER_CODES ) {
+                return false;
+        }
+
+        filter->code[filter->codes++] = code;
+        filter->arg |= VIWERR_BY_CODE;
+        return true;
+
+}
+
+bool
+viwerr_filter_add_group(
+        viwerr_filter * filter,
+        const char * group )
+{
+
+        if( filter == NULL
+        ||  filter->groups >= VIWERR_FILTER_GROUPS ) {
+                return false;
+        }
+
+        if( group == NULL ) {
+                group = "";
+        }
+
+        size_t length;
+        size_t at = filter->groups++;
+
+        filter->group_hash[at] = _viwerr_hash(
+                group, VIWERR_GROUP_SIZE, &length
+        );
+        VIWERR_LOCK();
+        filter->group_id[at] = _viwerr_intern_hashed(
+                group, length, filter->group_hash[at], true
+        );
+        VIWERR_UNLOCK();
+        filter->group[at] = filter->group_id[at] != 0 ?
+                _viwerr_intern_string(filter->group_id[at]) :
+                group;
+        filter->arg |= VIWERR_BY_GROUP;
+        return true;
+
+}
+
+/**
+ * @brief
+ * Interned strings are equal only if their ids are,
+ * a filter string that is not in the table can
+ * only match a string that was copied into its slot
+ * or pushed with VIWERR_STATIC. Those are rejected if
+ * their hashes differ, otherwise compared by pointer
+ * and only then by strncmp(3).
+ */
+static inline bool
+_viwerr_filter_string(
+        unsigned slot_id,
+        uint64_t slot_hash,
+        const char * slot,
+        unsigned id,
+        uint64_t hash,
+        const char * string,
+        size_t size )
+{
+
+        if( slot_id != 0 ) {
+                return slot_id == id;
+        }
+
+        return slot_hash == hash
+            && ( slot == string
+            ||   strncmp(slot, string, size - 1) == 0 );
+
+}
+
+bool
+_viwerr_filter_by(
         const char * file,
         int line,
-        viwerr_package * package,
-        viwerr_package * filter )
+        _viwerr_ring * ring,
+        size_t index,
+        viwerr_filter * filter )
 {
 
-        if( package == NULL
-        ||  filter  == NULL ) {
+        if( ring   == NULL
+        ||  filter == NULL ) {
 
                 fprintf(stderr,
                 " VIWERR-INTERLNAL-CALL:\n"
                 "_viwerr_filter_by: expected parameters"
-                " \"package\" and \"filter\" to be 2 non"
-                " non NULL pointer viwerr_package*'s." 
-                " File: %s\n" 
+                " \"ring\" and \"filter\" to be 2 non"
+                " non NULL pointers."
+                " File: %s\n"
                 " Line: %d\n"
                 "viwerr file fprintf called at:\n"
                 " %d : %s\n",
                 file, line,__LINE__,__FILE__
-                );   
+                );
+                return false;
 
         }
 
         /**
-         * @brief 
+         * @brief
          * Start the evaluation, if any of these conditionals
-         * with ternary operators proves false then we return 0, 
-         * otherwise we return 1;
+         * proves false then we return 0, otherwise we return 1.
+         * Codes & groups pass if any of the filters do.
          */
 
         bool evaluation = true;
+        size_t i;
 
-        if( arg & VIWERR_BY_CODE ) {
+        if( filter->arg & VIWERR_BY_CODE ) {
 
-                evaluation = package->code != filter->code 
-                        ? false : true;
+                evaluation = false;
+                for( i = 0; i < filter->codes && !evaluation; i++ ) {
+                        evaluation = ring->code[index] == filter->code[i];
+                }
                 if( evaluation == 0 ) return evaluation;
 
         }
 
-        if( arg & VIWERR_BY_NAME ) {
+        if( filter->arg & VIWERR_BY_NAME ) {
 
-                evaluation = strncmp(
-                        package->name, 
+                evaluation = _viwerr_filter_string(
+                        ring->name_id[index],
+                        ring->name_hash[index],
+                        ring->name[index],
+                        filter->name_id,
+                        filter->name_hash,
                         filter->name,
                         VIWERR_NAME_SIZE
-                ) != 0 ? false : true;
+                );
                 if( evaluation == 0 ) return evaluation;
 
         }
 
-        if( arg & VIWERR_BY_MESSAGE ) {
+        if( filter->arg & VIWERR_BY_MESSAGE ) {
 
-                evaluation = strncmp(
-                        package->message, 
+                evaluation = _viwerr_filter_string(
+                        0,
+                        ring->message_hash[index],
+                        ring->message[index],
+                        0,
+                        filter->message_hash,
                         filter->message,
                         VIWERR_MESSAGE_SIZE
-                ) != 0 ? false : true;
+                );
                 if( evaluation == 0 ) return evaluation;
 
         }
 
-        if( arg & VIWERR_BY_GROUP ) {
+        if( filter->arg & VIWERR_BY_GROUP ) {
 
-                evaluation = strncmp(
-                        package->group, 
-                        filter->group,
-                        VIWERR_GROUP_SIZE
-                ) != 0 ? false : true;
+                evaluation = false;
+                for( i = 0; i < filter->groups && !evaluation; i++ ) {
+                        evaluation = _viwerr_filter_string(
+                                ring->group_id[index],
+                                ring->group_hash[index],
+                                ring->group[index],
+                                filter->group_id[i],
+                                filter->group_hash[i],
+                                filter->group[i],
+                                VIWERR_GROUP_SIZE
+                        );
+                }
                 if( evaluation == 0 ) return evaluation;
 
         }
 
         return evaluation;
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,33 @@
+#include "../viwerr.h"
+void
+_viwerr_ring_flush(
+        _viwerr_ring * ring )
+{
+
+        ring->amount = 0;
+
+        if( ++ring->epoch != 0 ) {
+                return;
+        }
+
+        /**
+         * @brief
+         * The epoch wrapped around, slots & counters stamped
+         * 2^32 flushes ago would look current again. Reset
+         * all of them to the empty state of epoch 0.
+         */
+        memset(ring->live, 0,
+                sizeof(uint64_t) * VIWERR_LIVE_WORDS(ring->capacity));
+        memset(ring->group_count, 0, sizeof(ring->group_count));
+        memset(ring->group_epoch, 0, sizeof(ring->group_epoch));
+        ring->push_last = VIWERR_NONE;
+
+        size_t i;
+        for( i = 0; i < ring->capacity; i++ ) {
+                ring->code_head[i]  = VIWERR_NONE;
+                ring->generation[i] = 0;
+                ring->state[i] =
+                        VIWERR_STATE_RETURNED|VIWERR_STATE_PRINTED;
+        }
+
+}
@@ -0,0 +1,109 @@
+#include "../viwerr.h"
+viwerr_frame
+viwerr_frame_begin(
+        void )
+{
+
+        VIWERR_LOCK();
+
+        _viwerr_ring *ring = _viwerr_list_init();
+
+        viwerr_frame frame = {
+                .pushed   = ring->pushed,
+                .newest   = ring->newest,
+                .capacity = ring->capacity,
+                .ended    = false
+        };
+
+        VIWERR_UNLOCK();
+        return frame;
+
+}
+
+void
+viwerr_frame_end(
+        viwerr_frame * frame,
+        bool drop )
+{
+
+        if( frame == NULL || frame->ended == true ) {
+                return;
+        }
+
+        frame->ended = true;
+
+        /**
+         * @brief
+         * The packages are promoted to the enclosing frame
+         * simply by being left alone.
+         */
+        if( drop != true ) {
+                return;
+        }
+
+        VIWERR_LOCK();
+
+        _viwerr_ring *ring = _viwerr_list_init();
+
+        /**
+         * @brief
+         * The push list is sorted by sequence, the packages
+         * of the frame are the ones at its newest end. Inner
+         * frames that were dropped already took theirs.
+         */
+        size_t at = ring->push_last;
+        bool others = false;
+
+        if( at != VIWERR_NONE
+        &&  ring->generation[at] != ring->epoch ) {
+                at = VIWERR_NONE;
+        }
+
+        while( at != VIWERR_NONE
+        &&     ring->sequence[at] >= frame->pushed ) {
+
+                size_t prev = ring->push_prev[at];
+
+                /**
+                 * @brief
+                 * With one ring shared by every thread the
+                 * packages other threads pushed while the frame
+                 * was open are left alone.
+                 */
+#ifdef VIWERR_INBOX
+                if( ring->thread[at] != _viwerr_thread_id() ) {
+                        others = true;
+                        at = prev;
+                        continue;
+                }
+#endif
+                _viwerr_clear_package(ring, at);
+                at = prev;
+
+        }
+
+        /**
+         * @brief
+         * Go back to the ring head of the frame, indexes
+         * are only the same if the ring was not resized. Not
+         * if packages of other threads are still after it,
+         * the next pushes would overwrite them.
+         */
+        if( ring->capacity == frame->capacity
+        &&  ring->pushed   != frame->pushed
+        &&  others != true ) {
+                ring->newest = frame->newest;
+        }
+
+        VIWERR_UNLOCK();
+
+}
+
+void
+_viwerr_frame_cleanup(
+        viwerr_frame * frame )
+{
+
+        viwerr_frame_end(frame, true);
+
+}
@@ -7,22 +7,15 @@ __attribute__((destructor))
 _viwerr_list_free(
     void )
 {
-        
-        viwerr_package ** array = _viwerr_list_init();
 
-        int i;
-        for( i = 0; i < (int)VIWERR_PACKAGE_AMOUNT; i++ ) {
-
-                free(array[i]->name);
-                free(array[i]->message);
-                free(array[i]->group);
-                free(array[i]->file);
-                free(array[i]);
-
-        }
-
-        free(array);
+        /**
+         * @brief
+         * Every array of the ring lives inside of one
+         * block, see _viwerr_ring_alloc(2).
+         */
+        _viwerr_ring *ring = _viwerr_list_init();
+        free(ring->block);
+        ring->block = NULL;
         return;
 
 }
-
@@ -0,0 +1,52 @@
+#include "../viwerr.h"
+uint64_t
+_viwerr_hash(
+        const char * string,
+        size_t size,
+        size_t * length )
+{
+
+        if( string == NULL ) {
+                string = "";
+        }
+
+        /**
+         * @brief
+         * FNV-1a over at most size - 1 characters, the same
+         * part of the string snprintf(3) would have copied.
+         */
+        uint64_t hash = VIWERR_HASH_EMPTY;
+        size_t count = 0;
+        while( count < size - 1 && string[count] != '\0' ) {
+
+                hash ^= (unsigned char)string[count++];
+                hash *= UINT64_C(1099511628211);
+
+        }
+
+        if( length != NULL ) {
+                *length = count;
+        }
+
+        return hash;
+
+}
+
+uint64_t
+_viwerr_hash_copy(
+        char * buffer,
+        const char * string,
+        size_t size )
+{
+
+        size_t length;
+        uint64_t hash = _viwerr_hash(string, size, &length);
+
+        if( length != 0 ) {
+                memcpy(buffer, string, length);
+        }
+        buffer[length] = '\0';
+
+        return hash;
+
+}
@@ -0,0 +1,217 @@
+#define VIWERR_REMOVE_FOR_OBJ_COMP
+#include "../viwerr.h"
+#ifdef VIWERR_INBOX
+#include <sched.h>
+
+_viwerr_inbox _viwerr_inbox_global;
+
+/**
+ * @brief
+ * Cells start out free for the tickets of the first lap,
+ * the sequence of cell i has to be i before the first push.
+ */
+#ifdef __GNUC__
+__attribute__((constructor))
+#endif
+static void
+_viwerr_inbox_init(
+        void )
+{
+
+        size_t i;
+        for( i = 0; i < VIWERR_INBOX_AMOUNT; i++ ) {
+                _viwerr_inbox_global.cell[i].sequence = i;
+        }
+
+}
+
+/**
+ * @brief
+ * Copy at most size - 1 characters of @b string, NULL
+ * is copied as "".
+ */
+static char *
+_viwerr_inbox_copy(
+        char * buffer,
+        const char * string,
+        size_t size )
+{
+
+        size_t length = 0;
+
+        if( string != NULL ) {
+                while( length < size - 1 && string[length] != '\0' ) {
+                        length++;
+                }
+                memcpy(buffer, string, length);
+        }
+
+        buffer[length] = '\0';
+        return buffer;
+
+}
+
+void
+_viwerr_inbox_push(
+        int              arg,
+        char*            func,
+        const char *     file,
+        int              line,
+        viwerr_package * package )
+{
+
+        _viwerr_inbox *inbox = &_viwerr_inbox_global;
+
+        size_t ticket = __atomic_fetch_add(
+                &inbox->head, 1, __ATOMIC_RELAXED
+        );
+        _viwerr_inbox_cell *cell =
+                &inbox->cell[ticket & (VIWERR_INBOX_AMOUNT - 1)];
+
+        /**
+         * @brief
+         * The cell is still taken by the package of the
+         * last lap, the inbox is full. Drain it instead of
+         * waiting for a reader that may never come, if the
+         * drain stops at a package that is not published yet
+         * give its thread the CPU.
+         */
+        while( __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE)
+               != ticket ) {
+
+                _viwerr_lock();
+                _viwerr_inbox_drain();
+                _viwerr_unlock();
+                sched_yield();
+
+        }
+
+        const char *name    = package->name;
+        const char *message = package->message;
+
+#ifdef VIWERR_SUBSCRIPTION_ERRNO
+        /**
+         * @brief
+         * errno belongs to the pushing thread, set it here
+         * instead of when the package reaches the ring. The
+         * default message comes from the static table, only
+         * a code it does not know has its message copied so
+         * the package can not keep VIWERR_STATIC.
+         */
+        if( package->group != NULL
+        && !strncmp(package->group, "errno", 5)
+        && !(arg & VIWERR_NO_ERRNO_TRIGGER) ) {
+
+                errno = package->code;
+                if( name == NULL ) {
+                        name = errnoname(package->code);
+                }
+                if( message == NULL ) {
+                        message = _viwerr_errno_message(package->code);
+                        if( message != NULL ) {
+                                arg |= VIWERR_STATIC_MESSAGE;
+                        } else {
+                                message = _viwerr_errno_strerror(
+                                        package->code
+                                );
+                                arg &= ~(VIWERR_STATIC);
+                        }
+                }
+                viwerr_errno_ignore_new(true);
+
+        }
+#endif
+
+        cell->arg    = arg|VIWERR_NO_ERRNO_TRIGGER;
+        cell->code   = package->code;
+        cell->line   = line;
+        cell->thread = _viwerr_thread_id();
+
+        if( arg & VIWERR_STATIC ) {
+                cell->name    = (char*)(name != NULL ? name : "");
+                cell->message = (char*)(message != NULL ? message : "");
+                cell->group   = package->group != NULL ?
+                        package->group : (char*)"";
+        } else {
+                cell->name = _viwerr_inbox_copy(
+                        cell->buffers.name, name, VIWERR_NAME_SIZE
+                );
+                if( arg & VIWERR_STATIC_MESSAGE ) {
+                        cell->message = (char*)(
+                                message != NULL ? message : ""
+                        );
+                } else {
+                        cell->message = _viwerr_inbox_copy(
+                                cell->buffers.message, message,
+                                VIWERR_MESSAGE_SIZE
+                        );
+                }
+                cell->group = _viwerr_inbox_copy(
+                        cell->buffers.group, package->group,
+                        VIWERR_GROUP_SIZE
+                );
+        }
+
+        if( arg & VIWERR_STATIC_LOCATION ) {
+                cell->file = (char*)(file != NULL ? file : "");
+                cell->func = func != NULL ? func : (char*)"";
+        } else {
+                cell->file = _viwerr_inbox_copy(
+                        cell->buffers.file, file, VIWERR_FILENAME_SIZE
+                );
+                cell->func = _viwerr_inbox_copy(
+                        cell->buffers.func, func, VIWERR_FUNCTION_SIZE
+                );
+        }
+
+        __atomic_store_n(&cell->sequence, ticket + 1, __ATOMIC_RELEASE);
+
+}
+
+void
+_viwerr_inbox_drain(
+        void )
+{
+
+        _viwerr_inbox *inbox = &_viwerr_inbox_global;
+        _viwerr_ring  *ring  = _viwerr_list_init();
+
+        /**
+         * @brief
+         * Stop at the first cell that is not published yet,
+         * the ones after it wait for the next drain so the
+         * packages reach the ring in ticket order.
+         */
+        for( ;; ) {
+
+                _viwerr_inbox_cell *cell =
+                        &inbox->cell[inbox->tail & (VIWERR_INBOX_AMOUNT - 1)];
+
+                if( __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE)
+                    != inbox->tail + 1 ) {
+                        break;
+                }
+
+                _viwerr_push_unlocked(
+                        cell->arg, cell->func, cell->file, cell->line,
+                        &(viwerr_package){
+                                .code    = cell->code,
+                                .name    = cell->name,
+                                .message = cell->message,
+                                .group   = cell->group
+                        }
+                );
+                ring->thread[ring->newest] = cell->thread;
+
+                __atomic_store_n(
+                        &cell->sequence,
+                        inbox->tail + VIWERR_INBOX_AMOUNT,
+                        __ATOMIC_RELEASE
+                );
+                inbox->tail++;
+
+        }
+
+}
+
+#endif /** @c VIWERR_INBOX */
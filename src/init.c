@@ -1,90 +1,129 @@
 #include <stdlib.h>
 #include "../viwerr.h"
-viwerr_package**
-_viwerr_list_init(
-        void )
+bool
+_viwerr_ring_alloc(
+        _viwerr_ring * ring,
+        size_t capacity )
 {
 
+        /**
+         * @brief
+         * The whole ring is one block of memory. Arrays
+         * are laid out from the largest alignment to the
+         * smallest so each of them starts aligned.
+         */
+        size_t words = VIWERR_LIVE_WORDS(capacity);
+        char *block = (char*)malloc(
+                VIWERR_SLOT_SIZE * capacity + sizeof(uint64_t) * words
+        );
+
+        if( block == NULL ) {
+                return false;
+        }
 
-        static viwerr_package **array = NULL;
-        /*viwerr_package *empty_package = viwerr_package_empty;*/
+        char *at = block;
+
+        ring->live      = (uint64_t*)at;
+        at += sizeof(uint64_t) * words;
+        ring->code_head = (size_t*)at;
+        at += sizeof(size_t) * capacity;
+        ring->code_next = (size_t*)at;
+        at += sizeof(size_t) * capacity;
+        ring->code_prev = (size_t*)at;
+        at += sizeof(size_t) * capacity;
+        ring->push_next = (size_t*)at;
+        at += sizeof(size_t) * capacity;
+        ring->push_prev = (size_t*)at;
+        at += sizeof(size_t) * capacity;
+        ring->sequence     = (uint64_t*)at;
+        at += sizeof(uint64_t) * capacity;
+        ring->name_hash    = (uint64_t*)at;
+        at += sizeof(uint64_t) * capacity;
+        ring->message_hash = (uint64_t*)at;
+        at += sizeof(uint64_t) * capacity;
+        ring->group_hash   = (uint64_t*)at;
+        at += sizeof(uint64_t) * capacity;
+        ring->view     = (viwerr_package*)at;
+        at += sizeof(viwerr_package) * capacity;
+        ring->name     = (char**)at;
+        at += sizeof(char*) * capacity;
+        ring->message  = (char**)at;
+        at += sizeof(char*) * capacity;
+        ring->group    = (char**)at;
+        at += sizeof(char*) * capacity;
+        ring->file     = (char**)at;
+        at += sizeof(char*) * capacity;
+        ring->func     = (char**)at;
+        at += sizeof(char*) * capacity;
+        ring->code     = (int*)at;
+        at += sizeof(int) * capacity;
+        ring->line     = (int*)at;
+        at += sizeof(int) * capacity;
+        ring->name_id  = (unsigned*)at;
+        at += sizeof(unsigned) * capacity;
+        ring->group_id = (unsigned*)at;
+        at += sizeof(unsigned) * capacity;
+        ring->thread   = (unsigned*)at;
+        at += sizeof(unsigned) * capacity;
+        ring->generation = (uint32_t*)at;
+        at += sizeof(uint32_t) * capacity;
+        ring->state    = (uint8_t*)at;
+        at += sizeof(uint8_t) * capacity;
+        ring->buffers  = (_viwerr_buffers*)at;
+
+        ring->block    = block;
+        ring->capacity = capacity;
+        ring->mask     = capacity - 1;
+        ring->push_last = VIWERR_NONE;
+
+        memset(ring->live, 0, sizeof(uint64_t) * words);
+
+        size_t i;
+        for( i = 0; i < capacity; i++ ) {
+                ring->code_head[i]  = VIWERR_NONE;
+                ring->generation[i] = ring->epoch;
+                _viwerr_clear_package(ring, i);
+        }
 
-        if( array == NULL ) {
+        return true;
 
-                //errno = 0;
+}
 
-                array = (viwerr_package**)malloc(
-                        sizeof(viwerr_package) * VIWERR_PACKAGE_AMOUNT
-                );
+VIWERR_RING_LOCAL _viwerr_ring _viwerr_ring_global = {
+        .block        = NULL,
+        .capacity     = VIWERR_PACKAGE_AMOUNT,
+        .mask         = VIWERR_PACKAGE_AMOUNT - 1,
+        .newest       = 0,
+        .amount       = 0,
+        .max_capacity = 0,
+        .epoch        = 0,
+        .pushed       = 0,
+        .push_last    = VIWERR_NONE
+};
+
+_viwerr_ring*
+_viwerr_list_init(
+        void )
+{
 
-                /**
-                 * @brief
-                 * Exit with code VIWERR_EXIT_CODE if we failed
-                 * to allocate memory for our error packages.
-                 */
-                if( array == NULL ) {
+        /**
+         * @brief
+         * Exit with code VIWERR_EXIT_CODE if we failed
+         * to allocate memory for our error packages.
+         */
+        if( _viwerr_ring_global.block == NULL ) {
+
+#ifdef VIWERR_THREAD_RINGS
+                _viwerr_threads_register(&_viwerr_ring_global);
+#endif
+                if( _viwerr_ring_alloc(
+                        &_viwerr_ring_global,
+                        _viwerr_ring_global.capacity) != true ) {
                         exit(VIWERR_EXIT_CODE);
                 }
 
-                int i;
-                for( i = 0; i < (int)VIWERR_PACKAGE_AMOUNT; i++ ) {
-
-                        array[i] = (viwerr_package*)malloc(
-                                sizeof(viwerr_package)
-                        );
-
-                        if( array[i] == NULL ) {
-                                exit(VIWERR_EXIT_CODE);
-                        }
-
-                        memcpy(
-                                array[i],
-                                &(viwerr_package){
-                                .code = viwerr_package_empty.code,
-                                .name = calloc(
-                                        VIWERR_NAME_SIZE,
-                                        sizeof(char)),
-                                .message = calloc(
-                                        VIWERR_MESSAGE_SIZE,
-                                        sizeof(char)),
-                                .group = calloc(
-                                        VIWERR_GROUP_SIZE,
-                                        sizeof(char)),
-                                .file = calloc(
-                                        VIWERR_FILENAME_SIZE,
-                                        sizeof(char)),
-                                .func = calloc(
-                                        VIWERR_FUNCTION_SIZE,
-                                        sizeof(char)),
-                                .line = viwerr_package_empty.line,
-				.flag = {
-					.returned = viwerr_package_empty.flag.returned,
-					.printed  = viwerr_package_empty.flag.printed,
-					.contains = viwerr_package_empty.flag.contains,
-				}
-                                // .flag.returned =
-                                        // viwerr_package_empty.flag.returned,
-                                // .flag.printed  =
-                                        // viwerr_package_empty.flag.printed,
-                                // .flag.contains =
-                                        // viwerr_package_empty.flag.contains,
-                                },
-                                sizeof(viwerr_package)
-                        );
-
-                        if( array[i]->name    == NULL
-                        ||  array[i]->message == NULL
-                        ||  array[i]->group   == NULL
-                        ||  array[i]->file    == NULL ) {
-
-                            exit(VIWERR_EXIT_CODE);
-
-                        }
-
-                }
-
         }
 
-        return array;
+        return &_viwerr_ring_global;
 
 }
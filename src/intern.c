@@ -0,0 +1,182 @@
+#include "../viwerr.h"
+
+/**
+ * @brief
+ * Open addressing table of interned strings, entry i
+ * has the id i + 1. Strings are copied into the arena
+ * once and never removed so their pointers stay valid.
+ */
+static struct {
+
+        struct {
+
+                const char *string;
+                uint64_t    hash;
+                size_t      length;
+
+        } entry[VIWERR_INTERN_AMOUNT];
+
+        char   arena[VIWERR_INTERN_ARENA_SIZE];
+        size_t arena_used;
+        size_t amount;
+
+} _viwerr_intern_table;
+
+/**
+ * @brief
+ * Entries are published by their string, in the thread
+ * safe build it is stored last & read with acquire so a
+ * lookup never takes the lock.
+ */
+#ifdef VIWERR_THREAD_SAFE
+#define VIWERR_INTERN_ENTRY(index) \
+        __atomic_load_n(&_viwerr_intern_table.entry[index].string, \
+                        __ATOMIC_ACQUIRE)
+#else
+#define VIWERR_INTERN_ENTRY(index) \
+        _viwerr_intern_table.entry[index].string
+#endif
+
+static unsigned
+_viwerr_intern_find(
+        const char * string,
+        size_t length,
+        uint64_t hash,
+        size_t * index )
+{
+
+        size_t mask = VIWERR_INTERN_AMOUNT - 1;
+        *index = (size_t)hash & mask;
+
+        while( VIWERR_INTERN_ENTRY(*index) != NULL ) {
+
+                if( _viwerr_intern_table.entry[*index].hash   == hash
+                &&  _viwerr_intern_table.entry[*index].length == length
+                &&  memcmp(_viwerr_intern_table.entry[*index].string,
+                           string, length) == 0 ) {
+                        return (unsigned)*index + 1;
+                }
+
+                *index = (*index + 1) & mask;
+
+        }
+
+        return 0;
+
+}
+
+unsigned
+_viwerr_intern_hashed(
+        const char * string,
+        size_t length,
+        uint64_t hash,
+        bool insert )
+{
+
+        if( string == NULL ) {
+                string = "";
+        }
+
+        size_t index;
+        unsigned id = _viwerr_intern_find(string, length, hash, &index);
+
+        if( id != 0 || insert != true ) {
+                return id;
+        }
+
+#ifdef VIWERR_THREAD_SAFE
+        /**
+         * @brief
+         * Another thread may have inserted the string (or
+         * taken the empty entry) since the lookup.
+         */
+        _viwerr_lock();
+        id = _viwerr_intern_find(string, length, hash, &index);
+#endif
+
+        /**
+         * @brief
+         * Keep the table at most 3/4 full so probing stays
+         * short, and never allocate.
+         */
+        if( id == 0
+        &&  _viwerr_intern_table.amount < VIWERR_INTERN_AMOUNT / 4 * 3
+        &&  _viwerr_intern_table.arena_used + length + 1
+                <= VIWERR_INTERN_ARENA_SIZE ) {
+
+                char *copy = &_viwerr_intern_table.arena[
+                        _viwerr_intern_table.arena_used
+                ];
+                memcpy(copy, string, length);
+                copy[length] = '\0';
+                _viwerr_intern_table.arena_used += length + 1;
+                _viwerr_intern_table.amount++;
+
+                _viwerr_intern_table.entry[index].hash   = hash;
+                _viwerr_intern_table.entry[index].length = length;
+#ifdef VIWERR_THREAD_SAFE
+                __atomic_store_n(&_viwerr_intern_table.entry[index].string,
+                                 copy, __ATOMIC_RELEASE);
+#else
+                _viwerr_intern_table.entry[index].string = copy;
+#endif
+
+                id = (unsigned)index + 1;
+
+        }
+
+#ifdef VIWERR_THREAD_SAFE
+        _viwerr_unlock();
+#endif
+        return id;
+
+}
+
+unsigned
+_viwerr_intern(
+        const char * string,
+        size_t size,
+        bool insert )
+{
+
+        size_t length;
+        uint64_t hash = _viwerr_hash(string, size, &length);
+
+        return _viwerr_intern_hashed(string, length, hash, insert);
+
+}
+
+const char *
+_viwerr_intern_string(
+        unsigned id )
+{
+
+        if( id == 0 || id > VIWERR_INTERN_AMOUNT ) {
+                return NULL;
+        }
+
+        return _viwerr_intern_table.entry[id - 1].string;
+
+}
+
+char *
+_viwerr_intern_store(
+        unsigned * id,
+        uint64_t * hash,
+        const char * string,
+        char * buffer,
+        size_t size )
+{
+
+        size_t length;
+        *hash = _viwerr_hash(string, size, &length);
+        *id   = _viwerr_intern_hashed(string, length, *hash, true);
+
+        if( *id != 0 ) {
+                return (char*)_viwerr_intern_string(*id);
+        }
+
+        _viwerr_hash_copy(buffer, string, size);
+        return buffer;
+
+}
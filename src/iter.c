@@ -0,0 +1,82 @@
+#include "../viwerr.h"
+void
+viwerr_iter_begin(
+        viwerr_iter *   iter,
+        viwerr_filter * filter,
+        bool            oldest_first )
+{
+
+        VIWERR_LOCK();
+
+        _viwerr_ring *ring = _viwerr_list_init();
+
+        /**
+         * @brief
+         * The slot after the newest one is the oldest,
+         * the ring is walked in the order repeated
+         * VIWERR_POP calls would return the packages.
+         */
+        iter->filter       = filter;
+        iter->oldest_first = oldest_first;
+        iter->walked       = 0;
+        iter->start        = oldest_first ?
+                (ring->newest + 1) & ring->mask : ring->newest;
+
+        VIWERR_UNLOCK();
+
+}
+
+viwerr_package *
+viwerr_iter_next(
+        viwerr_iter * iter )
+{
+
+        VIWERR_LOCK();
+
+        _viwerr_ring *ring = _viwerr_list_init();
+        viwerr_package *package = NULL;
+
+        while( iter->walked < ring->capacity ) {
+
+                if( iter->oldest_first ) {
+                        iter->walked += _viwerr_live_next(
+                                ring,
+                                (iter->start + iter->walked) & ring->mask,
+                                ring->capacity - iter->walked
+                        );
+                } else {
+                        iter->walked += _viwerr_live_prev(
+                                ring,
+                                (iter->start - iter->walked) & ring->mask,
+                                ring->capacity - iter->walked
+                        );
+                }
+
+                if( iter->walked >= ring->capacity ) {
+                        break;
+                }
+
+                size_t index = iter->oldest_first ?
+                        (iter->start + iter->walked) & ring->mask :
+                        (iter->start - iter->walked) & ring->mask;
+                iter->walked++;
+
+                if( iter->filter == NULL
+                ||  _viwerr_filter_by(
+                        __FILE__, __LINE__,
+                        ring, index, iter->filter) ) {
+
+                        package = _viwerr_package_view(ring, index);
+#ifdef VIWERR_INBOX
+                        package = _viwerr_package_copy(ring, package);
+#endif
+                        break;
+
+                }
+
+        }
+
+        VIWERR_UNLOCK();
+        return package;
+
+}
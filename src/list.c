@@ -1,574 +1,701 @@
 #define VIWERR_REMOVE_FOR_OBJ_COMP
 #include "../viwerr.h"
 viwerr_package*
-_viwerr_list(
+_viwerr_list_invalid(
         int          arg,
-        char*       func,
-        const char *file,
-        int         line,
-        int          cnt,
-        ... )
+        const char * file,
+        int          line )
 {
 
-        viwerr_package **packages = _viwerr_list_init();
+        /**
+         * @brief
+         * None or more than one of the arguments that
+         * cannot coexist were given, there is nothing
+         * to do.
+         */
+        if( !(arg & VIWERR_OPERATIONS) ) {
+
+                fprintf(stderr,
+                        " VIWERR-INTERLNAL-CALL:\n"
+                        "viwerr_list: requires 1 of the following"
+                        " arguments:\n"
+                        "\tVIWERR_PUSH,  \n"
+                        "\tVIWERR_POP,   \n"
+                        "\tVIWERR_FLUSH, \n"
+                        "\tVIWERR_PRINT, \n"
+                        "\tVIWERR_OCCURED\n"
+                        " File: %s\n"
+                        " Line: %d\n"
+                        "viwerr file fprintf called at:\n"
+                        " %d : %s\n",
+                        file, line,__LINE__,__FILE__
+                );
 
-        static struct {
+        } else {
+
+                fprintf(stderr,
+                        " VIWERR-INTERLNAL-CALL:\n"
+                        "viwerr_list: viwerr only accepts the"
+                        "following arguments one at time:\n"
+                        "\tVIWERR_PUSH, \n"
+                        "\tVIWERR_POP,  \n"
+                        "\tVIWERR_FLUSH,\n"
+                        "\tVIWERR_PRINT, \n"
+                        "\tVIWERR_OCCURED\n"
+                        " File: %s\n"
+                        " Line: %d\n"
+                        "viwerr file fprintf called at:\n"
+                        " %d : %s\n",
+                        file, line,__LINE__,__FILE__
+                );
+
+        }
 
-                int newest;
-                int amount;
+        return NULL;
 
-        } packageinfo = {
+}
 
-                .newest = 0,
-                .amount = 0
+viwerr_package*
+#ifdef VIWERR_INBOX
+_viwerr_push_unlocked(
+#else
+_viwerr_push(
+#endif
+        int          arg,
+        char*        func,
+        const char * file,
+        int          line,
+        viwerr_package * package )
+{
 
-        };
+        _viwerr_ring *ring = _viwerr_list_init();
 
         /**
          * @brief
          * Update once upon entering, viwerr_errno_redefine
-         * calls _viwerr_list in of it self so we have to
-         * be vary not to stack overflow by accident.
+         * pushes with VIWERR_NO_ERRNO_TRIGGER so it does not
+         * end up back here.
          */
-        static bool errno_update = true;
-        if(errno_update == true && !(arg & VIWERR_NO_ERRNO_TRIGGER)){
-                errno_update = false;
-                viwerr_errno_redefine(func,file,line);
-        }
-        errno_update = true;
+        _viwerr_errno_trigger(arg, func, file, line);
+
+        if( package == NULL ) {
+
+                fprintf(stderr,
+                        "viwerr: VIWERR_PUSH"
+                        " requires 1 NON NULL argument:\n"
+                        "        "
+                        "A viwerr_package pointer that"
+                        " contains any sort of values"
+                        " that are non negative (even for"
+                        " pointers).\n"
+                        " File: %s \n"
+                        " Line: %d \n"
+                        "viwerr file fprintf called at:\n"
+                        " line %d -> %s\n",
+                        file, line, __LINE__, __FILE__
+                );
+                return NULL;
 
+        }
 
+        size_t index = (ring->newest + 1) & ring->mask;
 
         /**
          * @brief
-         * Evaluate argument by counting the arguments
-         * that cannot coexist. If 0 then there is nothing to do.
-         * If 1 then everything is aokay. If 2 or more then
-         * we have to many arguments.
+         * If the slot still holds a package that was
+         * never returned and the ring is allowed to
+         * grow, double it instead of overwriting the
+         * package. If that fails we overwrite it anyway.
          */
-        int evalarg = _viwerr_popcnt(
-                arg & (VIWERR_FLUSH
-                      |VIWERR_POP
-                      |VIWERR_PUSH
-                      |VIWERR_PRINT
-                      |VIWERR_OCCURED)
-        );
+        if( VIWERR_STATE_PENDING(VIWERR_SLOT_STATE(ring, index))
+        &&  ring->capacity < ring->max_capacity
+        &&  _viwerr_ring_resize(ring, ring->capacity << 1) ) {
 
-        if(evalarg != 1) {
-
-                if( evalarg <= 0 ){
-
-                        fprintf(stderr,
-                                " VIWERR-INTERLNAL-CALL:\n"
-                                "viwerr_list: requires 1 of the following"
-                                " arguments:\n"
-                                "\tVIWERR_PUSH,  \n"
-                                "\tVIWERR_POP,   \n"
-                                "\tVIWERR_FLUSH, \n"
-                                "\tVIWERR_PRINT, \n"
-                                "\tVIWERR_OCCURED\n"
-                                " File: %s\n"
-                                " Line: %d\n"
-                                "viwerr file fprintf called at:\n"
-                                " %d : %s\n",
-                                file, line,__LINE__,__FILE__
-                        );
+                index = (ring->newest + 1) & ring->mask;
 
-                } else if( evalarg >= 2 ){
-
-                        fprintf(stderr,
-                                " VIWERR-INTERLNAL-CALL:\n"
-                                "viwerr_list: viwerr only accepts the"
-                                "following arguments one at time:\n"
-                                "\tVIWERR_PUSH, \n"
-                                "\tVIWERR_POP,  \n"
-                                "\tVIWERR_FLUSH,\n"
-                                "\tVIWERR_PRINT, \n"
-                                "\tVIWERR_OCCURED\n"
-                                " File: %s\n"
-                                " Line: %d\n"
-                                "viwerr file fprintf called at:\n"
-                                " %d : %s\n",
-                                file, line,__LINE__,__FILE__
-                        );
+        }
 
-                }
+        /**
+         * @brief
+         * Copy into the slot at index fully.
+         * If varadict package contains NULL pointers
+         * we write a empty string to the corresponding
+         * variable.
+         */
+        _viwerr_buffers *buffers = &ring->buffers[index];
 
-                return NULL;
+        /**
+         * @brief
+         * Take the slot out of the live bitmap & code
+         * index before its code changes.
+         */
+        _viwerr_live_set(ring, index, false);
 
-        }
+        ring->code[index] = package->code;
+        ring->line[index] = line;
 
-#ifdef VIWERR_DEBUG_MODE
-        fprintf(strderr,
-                "viwerr-debug: number of arguments passed to "
-               "viwerr_list = %d\n", cnt);
-        fprintf(stderr,
-                "viwerr-debug: static values:\n"
-                "\t packageinfo.newest = %d\n"
-                "\t packageinfo.amount = %d\n",
-                packageinfo.newest, packageinfo.amount);
-#endif
+        /**
+         * @brief
+         * Strings with a static lifetime are stored as
+         * they are. Otherwise name, group, file & function
+         * repeat a lot so they are interned, the slot only
+         * keeps a pointer (and an id for names & groups),
+         * and the message is copied.
+         */
+        if( arg & VIWERR_STATIC ) {
 
-        if( arg & VIWERR_PUSH ) {
+                ring->name_id[index]  = 0;
+                ring->group_id[index] = 0;
 
-                /**
-                 * @brief
-                 * Load 2 packages from va_list.
-                 * Overwrite flags from the first package
-                 * with flags from the second package only
-                 * if they are actual valid flags (0 or 1).
-                 * If they are not valid flags we keep whatever
-                 * the first package already had it set to prior
-                 * to the function call.
-                 */
-                if( cnt < 1 ) {
-
-                        fprintf(stderr,
-                                "viwerr: VIWERR_PUSH"
-                                " requires 1 argument:\n"
-                                "        "
-                                "A viwerr_package pointer that"
-                                " contains any sort of values"
-                                " that are non negative (even for"
-                                " pointers).\n"
-                                " File: %s \n"
-                                " Line: %d \n"
-                                "viwerr file fprintf called at:\n"
-                                " %d : %s\n",
-                                file, line,__LINE__,__FILE__
-                        );
-                        return NULL;
+                ring->name[index] =
+                        package->name != NULL ?
+                                package->name : (char*)"";
+                ring->group[index] =
+                        package->group != NULL ?
+                                package->group : (char*)"";
+                ring->message[index] =
+                        package->message != NULL ?
+                                package->message : (char*)"";
 
-                }
+                ring->name_hash[index] = _viwerr_hash(
+                        package->name, VIWERR_NAME_SIZE, NULL
+                );
+                ring->group_hash[index] = _viwerr_hash(
+                        package->group, VIWERR_GROUP_SIZE, NULL
+                );
+                ring->message_hash[index] = _viwerr_hash(
+                        package->message, VIWERR_MESSAGE_SIZE, NULL
+                );
 
-                va_list list;
+        } else {
 
-                va_start(list, cnt);
-                viwerr_package *package = (viwerr_package*)va_arg(
-                        list, viwerr_package*
+                ring->name[index] = _viwerr_intern_store(
+                        &ring->name_id[index],
+                        &ring->name_hash[index], package->name,
+                        buffers->name, VIWERR_NAME_SIZE
                 );
-                va_end(list);
-
-                if( package == NULL ) {
-
-                        fprintf(stderr,
-                                "viwerr: VIWERR_PUSH"
-                                " requires 1 NON NULL argument:\n"
-                                "        "
-                                "A viwerr_package pointer that"
-                                " contains any sort of values"
-                                " that are non negative (even for"
-                                " pointers).\n"
-                                " File: %s \n"
-                                " Line: %d \n"
-                                "viwerr file fprintf called at:\n"
-                                " line %d -> %s\n",
-                                file, line, __LINE__, __FILE__
-                        );
-                        return NULL;
 
-                }
+                ring->group[index] = _viwerr_intern_store(
+                        &ring->group_id[index],
+                        &ring->group_hash[index], package->group,
+                        buffers->group, VIWERR_GROUP_SIZE
+                );
 
-                int index = (packageinfo.newest + 1)
-                            % VIWERR_PACKAGE_AMOUNT;
+                if( arg & VIWERR_STATIC_MESSAGE ) {
+                        ring->message[index] =
+                                package->message != NULL ?
+                                        package->message : (char*)"";
+                        ring->message_hash[index] = _viwerr_hash(
+                                package->message,
+                                VIWERR_MESSAGE_SIZE, NULL
+                        );
+                } else {
+                        ring->message_hash[index] = _viwerr_hash_copy(
+                                buffers->message, package->message,
+                                VIWERR_MESSAGE_SIZE
+                        );
+                        ring->message[index] = buffers->message;
+                }
 
-                /**
-                 * @brief
-                 * Copy into the package at index fully.
-                 * If varadict package contains NULL pointers
-                 * we write a empty string to the corresponding
-                 * variable.
-                 * If varadict package contains negative integers
-                 * we clamp their values to 0.
-                 */
-                packages[index]->code =
-                        package->code != viwerr_package_new.code ?
-                                package->code : viwerr_package_new.code;
+        }
 
-                packages[index]->line =
-                        line != viwerr_package_new.line ?
-                                line : viwerr_package_new.line;
+        if( arg & VIWERR_STATIC_LOCATION ) {
 
-                snprintf(packages[index]->name,
-                        VIWERR_NAME_SIZE, "%s",
-                        package->name != NULL ?
-                                package->name :
-                                viwerr_package_new.name
-                );
+                ring->file[index] =
+                        file != NULL ? (char*)file : (char*)"";
+                ring->func[index] =
+                        func != NULL ? func : (char*)"";
 
-                snprintf(packages[index]->message,
-                        VIWERR_MESSAGE_SIZE, "%s",
-                        package->message != NULL ?
-                                package->message :
-                                viwerr_package_new.message
-                );
+        } else {
 
-                snprintf(packages[index]->group,
-                        VIWERR_GROUP_SIZE, "%s",
-                        package->group != NULL ?
-                                package->group :
-                                viwerr_package_new.group
+                unsigned id;
+                uint64_t hash;
+                ring->file[index] = _viwerr_intern_store(
+                        &id, &hash, file,
+                        buffers->file, VIWERR_FILENAME_SIZE
                 );
 
-                snprintf(packages[index]->file,
-                        VIWERR_FILENAME_SIZE, "%s",
-                        file != NULL ?
-                                file :
-                                viwerr_package_new.file
+                ring->func[index] = _viwerr_intern_store(
+                        &id, &hash, func,
+                        buffers->func, VIWERR_FUNCTION_SIZE
                 );
 
-                snprintf(packages[index]->func,
-                        VIWERR_FILENAME_SIZE, "%s",
-                        func != NULL ?
-                                func :
-                                viwerr_package_new.func
-                );
+        }
 
-                packages[index]->flag.returned =
-                        viwerr_package_new.flag.returned;
-                packages[index]->flag.printed  =
-                        viwerr_package_new.flag.printed;
-                packages[index]->flag.contains =
-                        viwerr_package_new.flag.contains;
+        ring->state[index]    = VIWERR_STATE_CONTAINS;
+        ring->sequence[index] = ring->pushed++;
+#ifdef VIWERR_INBOX
+        ring->thread[index]   = _viwerr_thread_id();
+#else
+        ring->thread[index]   = 0;
+#endif
+        _viwerr_live_set(ring, index, true);
 
-                packageinfo.newest = index;
-                packageinfo.amount +=
-                        (size_t)packageinfo.amount >= VIWERR_PACKAGE_AMOUNT ?
-                                0 : 1;
+        ring->newest = index;
 
 
 #ifdef VIWERR_SUBSCRIPTION_ERRNO
-                if(!strncmp(packages[index]->group, "errno", 5)
-                && !(arg & VIWERR_NO_ERRNO_TRIGGER)) {
-                        errno = packages[index]->code;
-                        if(package->name == NULL)
-                                packages[index]->name = (char*)errnoname(
-                                        packages[index]->code
+        if(!strncmp(ring->group[index], "errno", 5)
+        && !(arg & VIWERR_NO_ERRNO_TRIGGER)) {
+                errno = ring->code[index];
+                if(package->name == NULL)
+                        ring->name[index] =
+                                _viwerr_intern_store(
+                                &ring->name_id[index],
+                                &ring->name_hash[index],
+                                errnoname(ring->code[index]),
+                                buffers->name, VIWERR_NAME_SIZE
+                        );
+                if(package->message == NULL) {
+                        char const *message =
+                                _viwerr_errno_message(
+                                ring->code[index]
+                        );
+                        if(message != NULL) {
+                                ring->message[index] =
+                                        (char*)message;
+                                ring->message_hash[index] =
+                                        _viwerr_hash(
+                                        message,
+                                        VIWERR_MESSAGE_SIZE, NULL
                                 );
-                        if(package->message == NULL)
-                                packages[index]->message = strerror(
-                                        packages[index]->code
+                        } else {
+                                ring->message_hash[index] =
+                                        _viwerr_hash_copy(
+                                        buffers->message,
+                                        _viwerr_errno_strerror(
+                                        ring->code[index]),
+                                        VIWERR_MESSAGE_SIZE
                                 );
-                        viwerr_errno_ignore_new(true);
-
+                                ring->message[index] =
+                                        buffers->message;
+                        }
                 }
+                viwerr_errno_ignore_new(true);
+
+        }
 #endif
-                return package;
+        return package;
 
-        } else if( arg & VIWERR_POP
-               ||  arg & VIWERR_PRINT
-               ||  arg & VIWERR_OCCURED ) {
+}
 
-                /**
-                 * @brief
-                 * We do one full loop and attempt to find
-                 * the newest unpoped package.
-                 */
-                viwerr_package * newest_package = NULL;
-                int index = packageinfo.newest;
+viwerr_package*
+#ifdef VIWERR_INBOX
+_viwerr_pop_filter_unlocked(
+#else
+_viwerr_pop_filter(
+#endif
+        int             arg,
+        char*           func,
+        const char *    file,
+        int             line,
+        viwerr_filter * filter )
+{
 
-                /**
-                 * @brief
-                 * Filter if we combined VIWERR_POP with
-                 * one of the arguments from the VIWERR_BY family.
-                 */
-                viwerr_package * filter = NULL;
+        _viwerr_ring *ring = _viwerr_list_init();
 
-                /**
-                 * @brief
-                 * If we contiant one of the following arguments
-                 * we must check if we have a package passed
-                 * through VA_ARG.
-                 */
-                if( _viwerr_popcnt((long)(arg &
-                        (VIWERR_BY_CODE|
-                         VIWERR_BY_NAME|
-                         VIWERR_BY_MESSAGE|
-                         VIWERR_BY_GROUP)
-                ))) {
-
-                        if( cnt < 1 ) {
-
-                                fprintf(stderr,
-                                "viwerr: VIWERR_POP with a"
-                                " argument from the"
-                                " VIWERR_BY... family"
-                                " requires 1 argument:\n"
-                                "        "
-                                "A viwerr_package pointer that"
-                                " contains the values we will filter"
-                                " our packages with!\n"
-                                " File: %s \n"
-                                " Line: %d \n"
-                                "viwerr file fprintf called at:\n"
-                                " %d : %s\n",
-                                file, line,__LINE__,__FILE__
-                                );
-                                return NULL;
+        /**
+         * @brief
+         * Update once upon entering, viwerr_errno_redefine
+         * pushes with VIWERR_NO_ERRNO_TRIGGER so it does not
+         * end up back here.
+         */
+        _viwerr_errno_trigger(arg, func, file, line);
 
-                        }
+        /**
+         * @brief
+         * We do one full loop and attempt to find
+         * the newest unpoped package.
+         */
+        bool found = false;
+        size_t index = ring->newest;
 
-                        va_list list;
-                        va_start(list, cnt);
-                        filter = (viwerr_package*)va_arg(
-                                list, viwerr_package*
+        /**
+         * @brief
+         * A VIWERR_BY... argument without a package or
+         * filter to go with it.
+         */
+        if( filter == NULL
+        &&  arg & (VIWERR_BY_PACKAGE|VIWERR_BY_FILTER) ) {
+
+                fprintf(stderr,
+                "viwerr: VIWERR_POP with a"
+                " argument from the"
+                " VIWERR_BY... family"
+                " requires 1 NON NULL argument:\n"
+                "        "
+                "A viwerr_package pointer (viwerr_filter"
+                " with VIWERR_BY_FILTER) that"
+                " contains the values we will filter"
+                " our packages with!\n"
+                " File: %s \n"
+                " Line: %d \n"
+                "viwerr file fprintf called at:\n"
+                " %d : %s\n",
+                file, line,__LINE__,__FILE__
+                );
+                return NULL;
+
+        }
+
+        /**
+         * @brief
+         * Nothing to look for, this is all an unfiltered
+         * VIWERR_OCCURED costs when no error is pending.
+         */
+        if( ring->amount == 0 ) {
+
+                return NULL;
+
+        }
+
+        /**
+         * @brief
+         * With VIWERR_BY_CODE only the chains of the codes
+         * have to be visited. The chains are not ordered
+         * the way the ring is walked so we keep the
+         * match closest to the newest slot.
+         */
+        if( filter != NULL && (filter->arg & VIWERR_BY_CODE) ) {
+
+                size_t closest = ring->capacity;
+                size_t code;
+
+                for( code = 0; code < filter->codes; code++ ) {
+
+                        size_t chain = _viwerr_code_first(
+                                ring, filter->code[code]
                         );
-                        va_end(list);
-
-                        if( filter == NULL ) {
-
-                                fprintf(stderr,
-                                "viwerr: VIWERR_POP with a"
-                                " argument from the"
-                                " VIWERR_BY... family"
-                                " requires 1 NON NULL argument:\n"
-                                "        "
-                                "A viwerr_package pointer that"
-                                " contains the values we will filter"
-                                " our packages with!\n"
-                                " File: %s \n"
-                                " Line: %d \n"
-                                "viwerr file fprintf called at:\n"
-                                " %d : %s\n",
-                                file, line,__LINE__,__FILE__
-                                );
-                                return NULL;
+
+                        for( ; chain != VIWERR_NONE;
+                               chain = ring->code_next[chain] ) {
+
+                                size_t distance = (ring->newest
+                                        - chain) & ring->mask;
+
+                                if( distance < closest
+                                &&  _viwerr_filter_by(
+                                        file, line,
+                                        ring, chain, filter) ) {
+
+                                        closest = distance;
+                                        index   = chain;
+                                        found   = true;
+
+                                }
 
                         }
 
                 }
 
+        } else {
+
                 /**
                  * @brief
-                 * Loop through the entire list of packages
-                 * until we find one that fits the criteria.
+                 * Walk the packages that were not returned yet,
+                 * newest first, until we find one that fits the
+                 * criteria. The live bitmap lets us jump over
+                 * empty & returned slots.
                  */
-                do {
+                size_t walked = 0;
+                while( walked < ring->capacity ) {
+
+                        walked += _viwerr_live_prev(
+                                ring,
+                                (ring->newest - walked) & ring->mask,
+                                ring->capacity - walked
+                        );
+
+                        if( walked >= ring->capacity ) {
+                                break;
+                        }
 
-                        viwerr_package * package = packages[index];
+                        index = (ring->newest - walked) & ring->mask;
 
                         /**
                          * @brief
-                         * Check if package is empty and has not been
-                         * returned!
+                         * Evaluate if package fits criteria
+                         * if we have a VIWERR_BY... argument
+                         * with _viwerr_filter_by(...).
                          */
-                        if( package->flag.contains
-                                == viwerr_package_new.flag.contains
-                        &&  package->flag.returned
-                                == viwerr_package_new.flag.returned ) {
-
-                                /**
-                                 * @brief
-                                 * Evaluate if package fits criteria
-                                 * if we have a VIWERR_BY... argument
-                                 * with _viwerr_filter_by(...).
-                                 */
-                                bool eval = true;
-                                if( filter != NULL ) {
-
-                                        eval = _viwerr_filter_by(
-                                                arg, file, line,
-                                                package, filter
-                                        );
+                        bool eval = true;
+                        if( filter != NULL ) {
 
-                                }
+                                eval = _viwerr_filter_by(
+                                        file, line,
+                                        ring, index, filter
+                                );
 
-                                if( eval == true ) {
+                        }
 
-                                        newest_package = package;
-                                        break;
+                        if( eval == true ) {
 
-                                }
+                                found = true;
+                                break;
 
                         }
 
-                        index = (index - 1)
-                                % VIWERR_PACKAGE_AMOUNT;
+                        walked++;
 
+                }
 
+        }
 
-                } while (index != packageinfo.newest);
+        /**
+         * @brief
+         * Exit if no package was found.
+         */
+        if( found != true ) {
 
-                /**
-                 * @brief
-                 * Exit if no package was found.
-                 */
-                if( newest_package == NULL ) {
+                return NULL;
 
-                        return NULL;
+        };
 
-                };
+        /**
+         * @brief
+         * If VIWERR_OCCURED is the argument we leave
+         * everything as is and return the package.
+         */
+        if( arg & VIWERR_OCCURED ) {
 
-                /**
-                 * @brief
-                 * If VIWERR_OCCURED is the argument we leave
-                 * everything as is and return the package.
-                 */
-                if( arg & VIWERR_OCCURED ) {
+                return _viwerr_package_view(ring, index);
 
-                        return newest_package;
+        }
 
-                }
+        /**
+         * @brief
+         * If argument is VIWERR_PRINT we call
+         * _viwerr_print_package(1) before we return
+         * the package.
+         */
+        if( arg & VIWERR_PRINT ){
 
-                /**
-                 * @brief
-                 * If argument is VIWERR_PRINT we call
-                 * _viwerr_print_package(1) before we return
-                 * the package.
-                 */
-                if( arg & VIWERR_PRINT ){
+                ring->state[index] |= VIWERR_STATE_PRINTED;
+                fprintf(stderr, "\nviwerr: an exception was caught!");
+                _viwerr_print_package(
+                        _viwerr_package_view(ring, index)
+                );
 
-                        fprintf(stderr, "\nviwerr: an exception was caught!");
-                        _viwerr_print_package(newest_package);
-                        newest_package->flag.printed =
-                                viwerr_package_used.flag.printed;
+        }
+        /**
+         * @brief
+         * Update static information and send package.
+         * VIWERR_PRINT & VIWERR_POP
+         */
+        ring->state[index] |= VIWERR_STATE_RETURNED;
+        _viwerr_live_set(ring, index, false);
+        ring->newest = ring->amount == 0 ?
+                0 : (index - 1) & ring->mask;
 
-                }
-                /**
-                 * @brief
-                 * Update static information and send package.
-                 * VIWERR_PRINT & VIWERR_POP
-                 */
-                newest_package->flag.returned =
-                        viwerr_package_used.flag.returned;
-                packageinfo.amount -=
-                        packageinfo.amount <= 0 ? 0 : 1;
-                packageinfo.newest = packageinfo.amount <= 0 ?
-                        0 : (index - 1) % VIWERR_PACKAGE_AMOUNT;
+        return _viwerr_package_view(ring, index);
 
-                return newest_package;
 
+}
 
-        } else if( arg & VIWERR_FLUSH ) {
+void
+#ifdef VIWERR_INBOX
+_viwerr_flush_filter_unlocked(
+#else
+_viwerr_flush_filter(
+#endif
+        int             arg,
+        char*           func,
+        const char *    file,
+        int             line,
+        viwerr_filter * filter )
+{
 
-                /**
-                 * @brief
-                 * Amount of packages that were cleared.
-                 */
-                int cleared = 0;
-                int index = packageinfo.newest;
+        _viwerr_ring *ring = _viwerr_list_init();
 
-                /**
-                 * @brief
-                 * Filter if we combined VIWERR_FLUSH with
-                 * one of the arguments from the VIWERR_BY family.
-                 */
-                viwerr_package * filter = NULL;
-                /**
-                 * @brief
-                 * If we contiant one of the following arguments
-                 * we must check if we have a package passed
-                 * through VA_ARG.
-                 */
-                if( _viwerr_popcnt((long)(arg &
-                        (VIWERR_BY_CODE|
-                         VIWERR_BY_NAME|
-                         VIWERR_BY_MESSAGE|
-                         VIWERR_BY_GROUP)
-                ))) {
-
-                        if( cnt < 1 ) {
-
-                                fprintf(stderr,
-                                "viwerr: VIWERR_FLUSH with a"
-                                " argument from the"
-                                " VIWERR_BY... family"
-                                " requires 1 argument:\n"
-                                "        "
-                                "A viwerr_package pointer that"
-                                " contains the values we will filter"
-                                " our packages with!\n"
-                                " File: %s \n"
-                                " Line: %d \n"
-                                "viwerr file fprintf called at:\n"
-                                " %d : %s\n",
-                                file, line,__LINE__,__FILE__
-                                );
-                                return NULL;
+        /**
+         * @brief
+         * Update once upon entering, viwerr_errno_redefine
+         * pushes with VIWERR_NO_ERRNO_TRIGGER so it does not
+         * end up back here.
+         */
+        _viwerr_errno_trigger(arg, func, file, line);
 
-                        }
+        size_t index = ring->newest;
+
+        /**
+         * @brief
+         * A VIWERR_BY... argument without a package or
+         * filter to go with it.
+         */
+        if( filter == NULL
+        &&  arg & (VIWERR_BY_PACKAGE|VIWERR_BY_FILTER) ) {
+
+                fprintf(stderr,
+                "viwerr: VIWERR_FLUSH with a argument"
+                " from the VIWERR_BY... family"
+                " requires 1 NON NULL argument:\n"
+                "        "
+                "A viwerr_package pointer (viwerr_filter"
+                " with VIWERR_BY_FILTER) that"
+                " contains the values we will filter"
+                " our packages with!\n"
+                " File: %s \n"
+                " Line: %d \n"
+                "viwerr file fprintf called at:\n"
+                " %d : %s\n",
+                file, line,__LINE__,__FILE__
+                );
+                return;
+
+        }
 
-                        va_list list;
-                        va_start(list, cnt);
-                        filter = (viwerr_package*)va_arg(
-                                list, viwerr_package*
+        /**
+         * @brief
+         * Flushing everything only starts a new epoch,
+         * the slots are recycled as they are pushed into.
+         */
+        if( filter == NULL || filter->arg == 0 ) {
+
+                _viwerr_ring_flush(ring);
+                return;
+
+        }
+
+        /**
+         * @brief
+         * With VIWERR_BY_CODE walk only the chains of the
+         * codes. Returned packages are not in them, they are
+         * left for the next flush since nothing can pop
+         * them anymore.
+         */
+        if( filter != NULL && (filter->arg & VIWERR_BY_CODE) ) {
+
+                size_t code;
+
+                for( code = 0; code < filter->codes; code++ ) {
+
+                        size_t chain = _viwerr_code_first(
+                                ring, filter->code[code]
                         );
-                        va_end(list);
-
-                        if( filter == NULL ) {
-
-                                fprintf(stderr,
-                                "viwerr: VIWERR_FLUSH with a argument"
-                                " from the VIWERR_BY... family"
-                                " requires 1 NON NULL argument:\n"
-                                "        "
-                                "A viwerr_package pointer that"
-                                " contains the values we will filter"
-                                " our packages with!\n"
-                                " File: %s \n"
-                                " Line: %d \n"
-                                "viwerr file fprintf called at:\n"
-                                " %d : %s\n",
-                                file, line,__LINE__,__FILE__
-                                );
-                                return NULL;
+
+                        while( chain != VIWERR_NONE ) {
+
+                                size_t next = ring->code_next[chain];
+
+                                if( _viwerr_filter_by(
+                                        file, line,
+                                        ring, chain, filter) ) {
+                                        _viwerr_clear_package(
+                                                ring, chain
+                                        );
+                                }
+
+                                chain = next;
 
                         }
 
                 }
 
-                /**
-                 * @brief
-                 * Loop through the entire list of packages
-                 * until we find one that fits the criteria.
-                 */
-                do {
+                return;
+
+        }
+
+        /**
+         * @brief
+         * Loop through the entire list of packages
+         * and clear the ones that fit the criteria.
+         */
+        do {
+
+                if( VIWERR_SLOT_STATE(ring, index)
+                  & VIWERR_STATE_CONTAINS ){
+
+                        /**
+                         * @brief
+                         * Evaluate if package fits criteria
+                         * with _viwerr_filter_by(...).
+                         */
+                        bool eval = _viwerr_filter_by(
+                                file, line,
+                                ring, index, filter
+                        );
 
-                        viwerr_package * package = packages[index];
+                        if( eval == true ) {
 
-                        if( package->flag.contains
-                                == viwerr_package_new.flag.contains ){
+                                _viwerr_clear_package(ring, index);
 
-                                /**
-                                 * @brief
-                                 * Evaluate if package fits criteria
-                                 * if we have a VIWERR_BY... argument
-                                 * with _viwerr_filter_by(...).
-                                 */
+                        }
 
-                                bool eval = true;
-                                if( filter != NULL ) {
+                }
 
-                                        eval = _viwerr_filter_by(
-                                                arg, file, line,
-                                                package, filter
-                                        );
+                index = (index - 1) & ring->mask;
 
-                                }
+        } while (index != ring->newest);
 
-                                if( eval == true ) {
+        /**
+         * @brief
+         * _viwerr_clear_package(2) already updated the
+         * live bitmap & amount of packages.
+         */
 
-                                        _viwerr_clear_package(package);
-                                        cleared++;
+}
 
-                                }
+/**
+ * @brief
+ * The package of the VIWERR_BY... family is compiled into
+ * a filter for this call only. It is compiled with the lock
+ * held: taking it drains the inbox, which interns the names
+ * & groups of the pending packages, and a filter compiled
+ * before that would not know their intern ids.
+ */
+viwerr_package*
+_viwerr_pop(
+        int              arg,
+        char*            func,
+        const char *     file,
+        int              line,
+        viwerr_package * package )
+{
 
-                        }
+        viwerr_filter compiled;
 
-                        index = (index - 1)
-                                % VIWERR_PACKAGE_AMOUNT;
+        if( package == NULL
+        || !(arg & VIWERR_BY_PACKAGE) ) {
+                return _viwerr_pop_filter(arg, func, file, line, NULL);
+        }
 
-                } while (index != packageinfo.newest);
+        _viwerr_errno_trigger(arg, func, file, line);
 
-                /**
-                 * @brief
-                 * Update static information and send package.
-                 */
-                packageinfo.amount -= cleared;
-                return NULL;
+        VIWERR_LOCK();
+        _viwerr_filter_compile(&compiled, arg, package, false);
+        package = _viwerr_pop_filter(
+                arg|VIWERR_NO_ERRNO_TRIGGER, func, file, line, &compiled
+        );
+        VIWERR_UNLOCK();
 
+        return package;
+
+}
+
+void
+_viwerr_flush(
+        int              arg,
+        char*            func,
+        const char *     file,
+        int              line,
+        viwerr_package * package )
+{
+
+        viwerr_filter compiled;
+
+        if( package == NULL
+        || !(arg & VIWERR_BY_PACKAGE) ) {
+                _viwerr_flush_filter(arg, func, file, line, NULL);
+                return;
         }
 
-        return NULL;
+        _viwerr_errno_trigger(arg, func, file, line);
+
+        VIWERR_LOCK();
+        _viwerr_filter_compile(&compiled, arg, package, false);
+        _viwerr_flush_filter(
+                arg|VIWERR_NO_ERRNO_TRIGGER, func, file, line, &compiled
+        );
+        VIWERR_UNLOCK();
 
 }
@@ -0,0 +1,281 @@
+#include "../viwerr.h"
+
+/**
+ * @brief
+ * Index of the highest bit set in @b bits, which must
+ * not be 0.
+ */
+static unsigned
+_viwerr_live_top(
+        uint64_t bits )
+{
+
+#ifdef __GNUC__
+        return 63 - (unsigned)__builtin_clzll(bits);
+#else
+        unsigned top = 0;
+        while( bits >>= 1 )
+                top++;
+        return top;
+#endif
+
+}
+
+/**
+ * @brief
+ * Index of the lowest bit set in @b bits, which must
+ * not be 0.
+ */
+static unsigned
+_viwerr_live_bottom(
+        uint64_t bits )
+{
+
+#ifdef __GNUC__
+        return (unsigned)__builtin_ctzll(bits);
+#else
+        unsigned bottom = 0;
+        while( !(bits & 1) ) {
+                bits >>= 1;
+                bottom++;
+        }
+        return bottom;
+#endif
+
+}
+
+/**
+ * @brief
+ * Clear bit @b at of the word of slot @b index if its
+ * slot is left over from before the last unfiltered flush,
+ * every bit is cleared at most once this way.
+ */
+static bool
+_viwerr_live_stale(
+        _viwerr_ring * ring,
+        size_t index,
+        unsigned at )
+{
+
+        size_t slot = (index & ~(size_t)63) | at;
+
+        if( ring->generation[slot] == ring->epoch ) {
+                return false;
+        }
+
+        ring->live[index >> 6] &= ~((uint64_t)1 << at);
+        return true;
+
+}
+
+void
+_viwerr_live_set(
+        _viwerr_ring * ring,
+        size_t index,
+        bool live )
+{
+
+        uint64_t *word = &ring->live[index >> 6];
+        uint64_t  bit  = (uint64_t)1 << (index & 63);
+
+        /**
+         * @brief
+         * Recycle a slot left over from before the last
+         * unfiltered flush. Nothing counts it anymore, it
+         * can only still be the head of its chain or of
+         * the push list.
+         */
+        if( ring->generation[index] != ring->epoch ) {
+
+                size_t *head = &ring->code_head[
+                        VIWERR_CODE_BUCKET(ring, ring->code[index])
+                ];
+                if( *head == index ) {
+                        *head = VIWERR_NONE;
+                }
+                if( ring->push_last == index ) {
+                        ring->push_last = VIWERR_NONE;
+                }
+
+                *word &= ~bit;
+                ring->generation[index] = ring->epoch;
+                ring->state[index] =
+                        VIWERR_STATE_RETURNED|VIWERR_STATE_PRINTED;
+
+        }
+
+        if( live == true && !(*word & bit) ) {
+
+                unsigned group = ring->group_id[index];
+
+                *word |= bit;
+                ring->amount++;
+
+                if( ring->group_epoch[group] != ring->epoch ) {
+                        ring->group_epoch[group] = ring->epoch;
+                        ring->group_count[group] = 0;
+                }
+                ring->group_count[group]++;
+
+                /**
+                 * @brief
+                 * Link the slot in front of its code chain,
+                 * dropping the chain if it is left over.
+                 */
+                size_t *head = &ring->code_head[
+                        VIWERR_CODE_BUCKET(ring, ring->code[index])
+                ];
+                if( *head != VIWERR_NONE
+                &&  ring->generation[*head] != ring->epoch ) {
+                        *head = VIWERR_NONE;
+                }
+                ring->code_prev[index] = VIWERR_NONE;
+                ring->code_next[index] = *head;
+                if( *head != VIWERR_NONE ) {
+                        ring->code_prev[*head] = index;
+                }
+                *head = index;
+
+                /**
+                 * @brief
+                 * And behind the newest package of the push list.
+                 */
+                size_t last = ring->push_last;
+                if( last != VIWERR_NONE
+                &&  ring->generation[last] != ring->epoch ) {
+                        last = VIWERR_NONE;
+                }
+                ring->push_prev[index] = last;
+                ring->push_next[index] = VIWERR_NONE;
+                if( last != VIWERR_NONE ) {
+                        ring->push_next[last] = index;
+                }
+                ring->push_last = index;
+
+        } else if( live != true && (*word & bit) ) {
+
+                *word &= ~bit;
+                ring->amount--;
+                ring->group_count[ring->group_id[index]]--;
+
+                size_t prev = ring->code_prev[index];
+                size_t next = ring->code_next[index];
+
+                if( prev != VIWERR_NONE ) {
+                        ring->code_next[prev] = next;
+                } else {
+                        ring->code_head[
+                                VIWERR_CODE_BUCKET(ring, ring->code[index])
+                        ] = next;
+                }
+                if( next != VIWERR_NONE ) {
+                        ring->code_prev[next] = prev;
+                }
+
+                prev = ring->push_prev[index];
+                next = ring->push_next[index];
+
+                if( next != VIWERR_NONE ) {
+                        ring->push_prev[next] = prev;
+                } else {
+                        ring->push_last = prev;
+                }
+                if( prev != VIWERR_NONE ) {
+                        ring->push_next[prev] = next;
+                }
+
+        }
+
+}
+
+size_t
+_viwerr_live_prev(
+        _viwerr_ring * ring,
+        size_t from,
+        size_t limit )
+{
+
+        size_t walked = 0;
+
+        while( walked < limit ) {
+
+                size_t   index = (from - walked) & ring->mask;
+                unsigned bit   = (unsigned)(index & 63);
+
+                /**
+                 * @brief
+                 * Bits of the slots at or below index inside of
+                 * this word, the highest one is the closest.
+                 */
+                uint64_t bits = ring->live[index >> 6]
+                        & (bit == 63 ? ~(uint64_t)0 :
+                                ((uint64_t)1 << (bit + 1)) - 1);
+
+                if( bits != 0 ) {
+
+                        unsigned top = _viwerr_live_top(bits);
+
+                        if( _viwerr_live_stale(ring, index, top) ) {
+                                continue;
+                        }
+
+                        walked += bit - top;
+                        return walked < limit ? walked : limit;
+
+                }
+
+                walked += bit + 1;
+
+        }
+
+        return limit;
+
+}
+
+size_t
+_viwerr_live_next(
+        _viwerr_ring * ring,
+        size_t from,
+        size_t limit )
+{
+
+        size_t walked = 0;
+
+        while( walked < limit ) {
+
+                size_t   index = (from + walked) & ring->mask;
+                unsigned bit   = (unsigned)(index & 63);
+
+                /**
+                 * @brief
+                 * Bits of the slots at or above index inside of
+                 * this word, the lowest one is the closest.
+                 */
+                uint64_t bits = ring->live[index >> 6]
+                        & ~(((uint64_t)1 << bit) - 1);
+
+                if( bits != 0 ) {
+
+                        unsigned bottom = _viwerr_live_bottom(bits);
+
+                        if( _viwerr_live_stale(ring, index, bottom) ) {
+                                continue;
+                        }
+
+                        walked += bottom - bit;
+                        return walked < limit ? walked : limit;
+
+                }
+
+                /**
+                 * @brief
+                 * Rings smaller than a word wrap before its end.
+                 */
+                walked += ring->capacity < 64 ?
+                        ring->capacity - index : 64 - bit;
+
+        }
+
+        return limit;
+
+}
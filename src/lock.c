@@ -0,0 +1,53 @@
+#include "../viwerr.h"
+#ifdef VIWERR_THREAD_SAFE
+#include <sched.h>
+
+static char _viwerr_lock_taken = 0;
+
+/**
+ * @brief
+ * How many times the calling thread took the lock.
+ */
+static VIWERR_THREAD_LOCAL unsigned _viwerr_lock_depth = 0;
+
+void
+_viwerr_lock(
+        void )
+{
+
+        if( _viwerr_lock_depth++ != 0 ) {
+                return;
+        }
+
+        /**
+         * @brief
+         * The lock is only held for short walks of the ring,
+         * a holder that is not running has to get the CPU
+         * back before spinning on would do anything.
+         */
+        while( __atomic_test_and_set(&_viwerr_lock_taken, __ATOMIC_ACQUIRE) ) {
+                while( __atomic_load_n(&_viwerr_lock_taken, __ATOMIC_RELAXED) ) {
+                        sched_yield();
+                }
+        }
+
+#ifdef VIWERR_INBOX
+        _viwerr_inbox_drain();
+#endif
+
+}
+
+void
+_viwerr_unlock(
+        void )
+{
+
+        if( --_viwerr_lock_depth != 0 ) {
+                return;
+        }
+
+        __atomic_clear(&_viwerr_lock_taken, __ATOMIC_RELEASE);
+
+}
+
+#endif /** @c VIWERR_THREAD_SAFE */
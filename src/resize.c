@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include "../viwerr.h"
+bool
+_viwerr_ring_resize(
+        _viwerr_ring * ring,
+        size_t capacity )
+{
+
+        _viwerr_ring to = *ring;
+
+        if( _viwerr_ring_alloc(&to, capacity) != true ) {
+                return false;
+        }
+
+        /**
+         * @brief
+         * Copy the newest packages that fit, oldest first,
+         * to the start of the new block so the newest one
+         * ends up at index keep - 1 and the order of
+         * the packages stays the same.
+         */
+        size_t keep = ring->capacity < capacity ?
+                ring->capacity : capacity;
+        size_t index = (ring->newest - keep + 1) & ring->mask;
+        to.amount = 0;
+        memset(to.group_count, 0, sizeof(to.group_count));
+
+        size_t i;
+        for( i = 0; i < keep; i++ ) {
+
+                _viwerr_buffers *from = &ring->buffers[index];
+                _viwerr_buffers *into = &to.buffers[i];
+
+                to.state[i]    = VIWERR_SLOT_STATE(ring, index);
+                to.sequence[i] = ring->sequence[index];
+                to.code[i]     = ring->code[index];
+                to.line[i]     = ring->line[index];
+                to.name_id[i]  = ring->name_id[index];
+                to.group_id[i] = ring->group_id[index];
+                to.thread[i]   = ring->thread[index];
+
+                to.name_hash[i]    = ring->name_hash[index];
+                to.message_hash[i] = ring->message_hash[index];
+                to.group_hash[i]   = ring->group_hash[index];
+
+                /**
+                 * @brief
+                 * Copy the buffers and point the strings at
+                 * the buffers of the new slot if they were
+                 * pointing at the buffers of the old one,
+                 * interned & static strings stay where they are.
+                 */
+                *into = *from;
+                to.name[i] = ring->name[index] == from->name ?
+                        into->name : ring->name[index];
+                to.message[i] = ring->message[index] == from->message ?
+                        into->message : ring->message[index];
+                to.group[i] = ring->group[index] == from->group ?
+                        into->group : ring->group[index];
+                to.file[i] = ring->file[index] == from->file ?
+                        into->file : ring->file[index];
+                to.func[i] = ring->func[index] == from->func ?
+                        into->func : ring->func[index];
+
+                index = (index + 1) & ring->mask;
+
+        }
+
+        /**
+         * @brief
+         * Rebuild the live bitmap, code index & push list and
+         * recount the packages that were not returned yet, some
+         * may have been dropped when shrinking. They are linked
+         * in the order they were pushed in, found by walking the
+         * push list of the old ring from its oldest package.
+         * Slots left over from an older epoch were copied as
+         * empty ones and are not in it.
+         */
+        size_t first  = (ring->newest - keep + 1) & ring->mask;
+        size_t oldest = VIWERR_NONE;
+        size_t at     = ring->push_last;
+
+        if( at != VIWERR_NONE
+        &&  ring->generation[at] != ring->epoch ) {
+                at = VIWERR_NONE;
+        }
+
+        for( ; at != VIWERR_NONE; at = ring->push_prev[at] ) {
+                oldest = at;
+        }
+
+        for( at = oldest; at != VIWERR_NONE; at = ring->push_next[at] ) {
+
+                size_t into = (at - first) & ring->mask;
+
+                if( into < keep ) {
+                        _viwerr_live_set(&to, into, true);
+                }
+
+        }
+
+        free(ring->block);
+        to.newest = keep - 1;
+        *ring = to;
+
+        return true;
+
+}
@@ -0,0 +1,107 @@
+#define VIWERR_REMOVE_FOR_OBJ_COMP
+#include "../viwerr.h"
+#ifdef VIWERR_INBOX
+static unsigned _viwerr_thread_last = 0;
+static VIWERR_THREAD_LOCAL unsigned _viwerr_thread_self = 0;
+
+unsigned
+_viwerr_thread_id(
+        void )
+{
+
+        if( _viwerr_thread_self == 0 ) {
+                _viwerr_thread_self = __atomic_add_fetch(
+                        &_viwerr_thread_last, 1, __ATOMIC_RELAXED
+                );
+        }
+
+        return _viwerr_thread_self;
+
+}
+
+viwerr_package*
+_viwerr_push(
+        int          arg,
+        char*        func,
+        const char * file,
+        int          line,
+        viwerr_package * package )
+{
+
+        /**
+         * @brief
+         * Same as in _viwerr_push_unlocked, but outside of
+         * the lock since it may push.
+         */
+        _viwerr_errno_trigger(arg, func, file, line);
+
+        /**
+         * @brief
+         * A valid push goes through the inbox without the
+         * lock, an invalid one through the lock for its
+         * error message.
+         */
+        if( package != NULL ) {
+
+                _viwerr_inbox_push(arg, func, file, line, package);
+                return package;
+
+        }
+
+        _viwerr_lock();
+        _viwerr_push_unlocked(
+                arg|VIWERR_NO_ERRNO_TRIGGER, func, file, line, NULL
+        );
+        _viwerr_unlock();
+
+        return NULL;
+
+}
+
+viwerr_package*
+_viwerr_pop_filter(
+        int             arg,
+        char*           func,
+        const char *    file,
+        int             line,
+        viwerr_filter * filter )
+{
+
+        _viwerr_errno_trigger(arg, func, file, line);
+
+        _viwerr_lock();
+        viwerr_package *package = _viwerr_pop_filter_unlocked(
+                arg|VIWERR_NO_ERRNO_TRIGGER, func, file, line, filter
+        );
+
+        /**
+         * @brief
+         * The view lives in the ring, once the lock is released
+         * a push from another thread may overwrite it.
+         */
+        package = _viwerr_package_copy(_viwerr_list_init(), package);
+        _viwerr_unlock();
+
+        return package;
+
+}
+
+void
+_viwerr_flush_filter(
+        int             arg,
+        char*           func,
+        const char *    file,
+        int             line,
+        viwerr_filter * filter )
+{
+
+        _viwerr_errno_trigger(arg, func, file, line);
+
+        _viwerr_lock();
+        _viwerr_flush_filter_unlocked(
+                arg|VIWERR_NO_ERRNO_TRIGGER, func, file, line, filter
+        );
+        _viwerr_unlock();
+
+}
+#endif /** @c VIWERR_INBOX */
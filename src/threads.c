@@ -0,0 +1,328 @@
+#include <stdlib.h>
+#include "../viwerr.h"
+#ifdef VIWERR_THREAD_RINGS
+#include <pthread.h>
+
+/**
+ * @brief
+ * A thread that pushed at least once. @b ring points at
+ * its thread local ring, or at a copy of it once the
+ * thread exited with packages left in it.
+ */
+typedef struct _viwerr_thread_st {
+
+        _viwerr_ring              *ring;
+        bool                       exited;
+        struct _viwerr_thread_st  *next;
+
+} _viwerr_thread;
+
+/**
+ * @brief
+ * Only touched with the lock held.
+ */
+static _viwerr_thread *_viwerr_threads = NULL;
+static struct {
+
+        size_t capacity;
+        size_t max_capacity;
+
+} _viwerr_threads_config = {
+        .capacity     = VIWERR_PACKAGE_AMOUNT,
+        .max_capacity = 0
+};
+
+static VIWERR_THREAD_LOCAL _viwerr_thread *_viwerr_thread_self = NULL;
+static pthread_key_t  _viwerr_threads_key;
+static pthread_once_t _viwerr_threads_once = PTHREAD_ONCE_INIT;
+
+static void
+_viwerr_threads_unlink(
+        _viwerr_thread * thread )
+{
+
+        _viwerr_thread **at = &_viwerr_threads;
+        while( *at != thread ) {
+                at = &(*at)->next;
+        }
+        *at = thread->next;
+
+}
+
+/**
+ * @brief
+ * The thread local ring goes away with its thread, keep
+ * a copy if packages are left in it so they can still be
+ * walked & merged.
+ */
+static void
+_viwerr_threads_exit(
+        void * pointer )
+{
+
+        _viwerr_thread *thread = (_viwerr_thread*)pointer;
+        _viwerr_ring   *ring   = thread->ring;
+        _viwerr_ring   *copy   = NULL;
+
+        _viwerr_lock();
+
+        if( ring->amount != 0 ) {
+                copy = (_viwerr_ring*)malloc(sizeof(_viwerr_ring));
+        }
+
+        if( copy != NULL ) {
+                *copy          = *ring;
+                thread->ring   = copy;
+                thread->exited = true;
+        } else {
+                free(ring->block);
+                _viwerr_threads_unlink(thread);
+                free(thread);
+        }
+
+        ring->block         = NULL;
+        _viwerr_thread_self = NULL;
+
+        _viwerr_unlock();
+
+}
+
+static void
+_viwerr_threads_key_create(
+        void )
+{
+
+        pthread_key_create(&_viwerr_threads_key, _viwerr_threads_exit);
+
+}
+
+void
+_viwerr_threads_register(
+        _viwerr_ring * ring )
+{
+
+        pthread_once(&_viwerr_threads_once, _viwerr_threads_key_create);
+
+        _viwerr_lock();
+
+        ring->capacity     = _viwerr_threads_config.capacity;
+        ring->mask         = _viwerr_threads_config.capacity - 1;
+        ring->max_capacity = _viwerr_threads_config.max_capacity;
+
+        /**
+         * @brief
+         * The ring is allocated again if it was released
+         * by _viwerr_list_free(0), it is still listed then.
+         */
+        if( _viwerr_thread_self == NULL ) {
+
+                _viwerr_thread *thread =
+                        (_viwerr_thread*)malloc(sizeof(_viwerr_thread));
+
+                if( thread != NULL ) {
+                        thread->ring   = ring;
+                        thread->exited = false;
+                        thread->next   = _viwerr_threads;
+                        _viwerr_threads     = thread;
+                        _viwerr_thread_self = thread;
+                        pthread_setspecific(_viwerr_threads_key, thread);
+                }
+
+        }
+
+        _viwerr_unlock();
+
+}
+
+void
+_viwerr_threads_configure(
+        size_t capacity,
+        size_t max_capacity )
+{
+
+        _viwerr_lock();
+        _viwerr_threads_config.capacity     = capacity;
+        _viwerr_threads_config.max_capacity = max_capacity;
+        _viwerr_unlock();
+
+}
+#endif /** @c VIWERR_THREAD_RINGS */
+
+/**
+ * @brief
+ * Walk @b ring oldest first the same way viwerr_iter_next(1)
+ * does, @b stop is set once @b func returns false.
+ */
+static size_t
+_viwerr_threads_walk_ring(
+        _viwerr_ring *  ring,
+        viwerr_filter * filter,
+        bool         (* func)(viwerr_package * package, void * data),
+        void *          data,
+        bool *          stop )
+{
+
+        size_t visited = 0;
+        size_t walked  = 0;
+        size_t start   = (ring->newest + 1) & ring->mask;
+
+        if( ring->block == NULL ) {
+                return 0;
+        }
+
+        while( *stop != true
+        &&     walked < ring->capacity ) {
+
+                walked += _viwerr_live_next(
+                        ring,
+                        (start + walked) & ring->mask,
+                        ring->capacity - walked
+                );
+
+                if( walked >= ring->capacity ) {
+                        break;
+                }
+
+                size_t index = (start + walked) & ring->mask;
+                walked++;
+
+                if( filter != NULL
+                && !_viwerr_filter_by(
+                        __FILE__, __LINE__, ring, index, filter) ) {
+                        continue;
+                }
+
+                visited++;
+                *stop = func(_viwerr_package_view(ring, index), data) != true;
+
+        }
+
+        return visited;
+
+}
+
+size_t
+viwerr_threads_walk(
+        viwerr_filter * filter,
+        bool         (* func)(viwerr_package * package, void * data),
+        void *          data )
+{
+
+        if( func == NULL ) {
+
+                fprintf(stderr,
+                "viwerr_threads_walk: expected a non NULL"
+                " \"func\".\n"
+                "viwerr file fprintf called at:\n"
+                " %d : %s\n",
+                __LINE__,__FILE__
+                );
+                return 0;
+
+        }
+
+        size_t visited = 0;
+        bool   stop    = false;
+
+#ifdef VIWERR_THREAD_RINGS
+        _viwerr_lock();
+
+        _viwerr_thread *thread;
+        for( thread = _viwerr_threads;
+             thread != NULL && stop != true;
+             thread = thread->next ) {
+                visited += _viwerr_threads_walk_ring(
+                        thread->ring, filter, func, data, &stop
+                );
+        }
+
+        _viwerr_unlock();
+#else
+        VIWERR_LOCK();
+        visited = _viwerr_threads_walk_ring(
+                _viwerr_list_init(), filter, func, data, &stop
+        );
+        VIWERR_UNLOCK();
+#endif
+
+        return visited;
+
+}
+
+size_t
+viwerr_threads_merge(
+        void )
+{
+
+        size_t merged = 0;
+
+#ifdef VIWERR_THREAD_RINGS
+        /**
+         * @brief
+         * Take the rings of the threads that exited off the
+         * list first, nobody else touches them after that so
+         * they can be pushed from without the lock.
+         */
+        _viwerr_thread *exited = NULL;
+        _viwerr_thread *thread;
+        _viwerr_thread *next;
+
+        _viwerr_lock();
+        for( thread = _viwerr_threads; thread != NULL; thread = next ) {
+                next = thread->next;
+                if( thread->exited == true ) {
+                        _viwerr_threads_unlink(thread);
+                        thread->next = exited;
+                        exited       = thread;
+                }
+        }
+        _viwerr_unlock();
+
+        for( thread = exited; thread != NULL; thread = next ) {
+
+                _viwerr_ring *ring = thread->ring;
+                size_t walked = 0;
+                size_t start  = (ring->newest + 1) & ring->mask;
+
+                while( walked < ring->capacity ) {
+
+                        walked += _viwerr_live_next(
+                                ring,
+                                (start + walked) & ring->mask,
+                                ring->capacity - walked
+                        );
+
+                        if( walked >= ring->capacity ) {
+                                break;
+                        }
+
+                        size_t index = (start + walked) & ring->mask;
+                        walked++;
+
+                        _viwerr_push(
+                                VIWERR_PUSH|VIWERR_NO_ERRNO_TRIGGER,
+                                ring->func[index],
+                                ring->file[index],
+                                ring->line[index],
+                                &(viwerr_package){
+                                        .code    = ring->code[index],
+                                        .name    = ring->name[index],
+                                        .message = ring->message[index],
+                                        .group   = ring->group[index]
+                                }
+                        );
+                        merged++;
+
+                }
+
+                next = thread->next;
+                free(ring->block);
+                free(ring);
+                free(thread);
+
+        }
+#endif
+
+        return merged;
+
+}
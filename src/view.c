@@ -0,0 +1,100 @@
+#include "../viwerr.h"
+viwerr_package*
+_viwerr_package_view(
+        _viwerr_ring * ring,
+        size_t index )
+{
+
+        viwerr_package * view = &ring->view[index];
+        uint8_t state = ring->state[index];
+
+        view->code    = ring->code[index];
+        view->name    = ring->name[index];
+        view->message = ring->message[index];
+        view->group   = ring->group[index];
+        view->file    = ring->file[index];
+        view->func    = ring->func[index];
+        view->line    = ring->line[index];
+
+        view->flag.returned = state & VIWERR_STATE_RETURNED ? 1 : 0;
+        view->flag.printed  = state & VIWERR_STATE_PRINTED  ? 1 : 0;
+        view->flag.contains = state & VIWERR_STATE_CONTAINS ? 1 : 0;
+
+        return view;
+
+}
+
+/**
+ * @brief
+ * Copy @b string into @b buffer of @b size if it lives in
+ * one of the slot buffers of @b ring, return the string the
+ * copy should point to.
+ */
+static char*
+_viwerr_copy_string(
+        _viwerr_ring * ring,
+        char *         string,
+        char *         buffer,
+        size_t         size )
+{
+
+        if( string == NULL
+        ||  string <  (char*)ring->buffers
+        ||  string >= (char*)(ring->buffers + ring->capacity) ) {
+                return string;
+        }
+
+        _viwerr_hash_copy(buffer, string, size);
+        return buffer;
+
+}
+
+void
+_viwerr_package_copy_into(
+        _viwerr_ring *         ring,
+        const viwerr_package * package,
+        viwerr_package *       into,
+        viwerr_buffers *       buffers )
+{
+
+        *into = *package;
+        into->name = _viwerr_copy_string(
+                ring, package->name, buffers->name, VIWERR_NAME_SIZE
+        );
+        into->message = _viwerr_copy_string(
+                ring, package->message,
+                buffers->message, VIWERR_MESSAGE_SIZE
+        );
+        into->group = _viwerr_copy_string(
+                ring, package->group, buffers->group, VIWERR_GROUP_SIZE
+        );
+        into->file = _viwerr_copy_string(
+                ring, package->file, buffers->file, VIWERR_FILENAME_SIZE
+        );
+        into->func = _viwerr_copy_string(
+                ring, package->func, buffers->func, VIWERR_FUNCTION_SIZE
+        );
+
+}
+
+#ifdef VIWERR_INBOX
+static VIWERR_THREAD_LOCAL viwerr_package _viwerr_copy;
+static VIWERR_THREAD_LOCAL viwerr_buffers _viwerr_copy_buffers;
+
+viwerr_package*
+_viwerr_package_copy(
+        _viwerr_ring *   ring,
+        viwerr_package * package )
+{
+
+        if( package == NULL ) {
+                return NULL;
+        }
+
+        _viwerr_package_copy_into(
+                ring, package, &_viwerr_copy, &_viwerr_copy_buffers
+        );
+        return &_viwerr_copy;
+
+}
+#endif /** @c VIWERR_INBOX */
@@ -0,0 +1,324 @@
+#define _POSIX_C_SOURCE 200809L
+/**
+ * @brief
+ * O_TMPFILE is only defined with _GNU_SOURCE on glibc.
+ */
+#define _GNU_SOURCE
+#define VIWERR_REMOVE_FOR_OBJ_COMP
+#include "../viwerr.h"
+#ifdef VIWERR_WRAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+
+/**
+ * @brief
+ * Wrappers for the libc calls listed in WRAP_CALLS of the
+ * makefile, linked in with -Wl,--wrap=<call> (make -s
+ * wrap-flags prints them). The linker sends every call to
+ * <call> to __wrap_<call> & __real_<call> is the libc one.
+ * A package is pushed only when the call failed, so every
+ * failure is caught even if errno already held its value.
+ */
+int     __real_open(const char * path, int flags, ...);
+int     __real_close(int fd);
+ssize_t __real_read(int fd, void * buffer, size_t size);
+ssize_t __real_write(int fd, const void * buffer, size_t size);
+FILE   *__real_fopen(const char * path, const char * mode);
+void   *__real_malloc(size_t size);
+void   *__real_calloc(size_t amount, size_t size);
+void   *__real_realloc(void * pointer, size_t size);
+int     __real_socket(int domain, int type, int protocol);
+int     __real_bind(int fd, const struct sockaddr * address, socklen_t length);
+int     __real_listen(int fd, int backlog);
+int     __real_accept(int fd, struct sockaddr * address, socklen_t * length);
+int     __real_connect(int fd, const struct sockaddr * address, socklen_t length);
+ssize_t __real_send(int fd, const void * buffer, size_t size, int flags);
+ssize_t __real_recv(int fd, void * buffer, size_t size, int flags);
+
+int     __wrap_open(const char * path, int flags, ...);
+int     __wrap_close(int fd);
+ssize_t __wrap_read(int fd, void * buffer, size_t size);
+ssize_t __wrap_write(int fd, const void * buffer, size_t size);
+FILE   *__wrap_fopen(const char * path, const char * mode);
+void   *__wrap_malloc(size_t size);
+void   *__wrap_calloc(size_t amount, size_t size);
+void   *__wrap_realloc(void * pointer, size_t size);
+int     __wrap_socket(int domain, int type, int protocol);
+int     __wrap_bind(int fd, const struct sockaddr * address, socklen_t length);
+int     __wrap_listen(int fd, int backlog);
+int     __wrap_accept(int fd, struct sockaddr * address, socklen_t * length);
+int     __wrap_connect(int fd, const struct sockaddr * address, socklen_t length);
+ssize_t __wrap_send(int fd, const void * buffer, size_t size, int flags);
+ssize_t __wrap_recv(int fd, void * buffer, size_t size, int flags);
+
+/**
+ * @brief
+ * Set while a failure is being pushed, the push itself may
+ * allocate through a wrapped malloc(1).
+ */
+static VIWERR_THREAD_LOCAL bool _viwerr_wrap_pushing = false;
+
+/**
+ * @brief
+ * Push the errno package of the failed @b call.
+ */
+static void
+_viwerr_wrap_failed(
+        const char * call )
+{
+
+        if( _viwerr_wrap_pushing == true ) {
+                return;
+        }
+
+        _viwerr_wrap_pushing = true;
+        _viwerr_check_failed((char*)call, "libc", 0);
+        _viwerr_wrap_pushing = false;
+
+}
+
+int
+__wrap_open(
+        const char * path,
+        int flags,
+        ... )
+{
+
+        /**
+         * @brief
+         * The mode is only passed when a file may be created,
+         * with O_CREAT or (on Linux) as an unnamed O_TMPFILE.
+         * O_TMPFILE includes the bits of O_DIRECTORY, so all
+         * of them have to be set.
+         */
+        bool creates = (flags & O_CREAT) != 0;
+#ifdef O_TMPFILE
+        creates = creates || (flags & O_TMPFILE) == O_TMPFILE;
+#endif
+
+        mode_t mode = 0;
+        if( creates ) {
+                va_list list;
+                va_start(list, flags);
+                mode = (mode_t)va_arg(list, int);
+                va_end(list);
+        }
+
+        int fd = __real_open(path, flags, mode);
+        if( fd == -1 ) {
+                _viwerr_wrap_failed("open");
+        }
+        return fd;
+
+}
+
+int
+__wrap_close(
+        int fd )
+{
+
+        int result = __real_close(fd);
+        if( result == -1 ) {
+                _viwerr_wrap_failed("close");
+        }
+        return result;
+
+}
+
+ssize_t
+__wrap_read(
+        int fd,
+        void * buffer,
+        size_t size )
+{
+
+        ssize_t result = __real_read(fd, buffer, size);
+        if( result == -1 ) {
+                _viwerr_wrap_failed("read");
+        }
+        return result;
+
+}
+
+ssize_t
+__wrap_write(
+        int fd,
+        const void * buffer,
+        size_t size )
+{
+
+        ssize_t result = __real_write(fd, buffer, size);
+        if( result == -1 ) {
+                _viwerr_wrap_failed("write");
+        }
+        return result;
+
+}
+
+FILE *
+__wrap_fopen(
+        const char * path,
+        const char * mode )
+{
+
+        FILE *file = __real_fopen(path, mode);
+        if( file == NULL ) {
+                _viwerr_wrap_failed("fopen");
+        }
+        return file;
+
+}
+
+/**
+ * @brief
+ * An allocation of 0 bytes may return NULL without failing.
+ */
+void *
+__wrap_malloc(
+        size_t size )
+{
+
+        void *pointer = __real_malloc(size);
+        if( pointer == NULL && size != 0 ) {
+                _viwerr_wrap_failed("malloc");
+        }
+        return pointer;
+
+}
+
+void *
+__wrap_calloc(
+        size_t amount,
+        size_t size )
+{
+
+        void *pointer = __real_calloc(amount, size);
+        if( pointer == NULL && amount != 0 && size != 0 ) {
+                _viwerr_wrap_failed("calloc");
+        }
+        return pointer;
+
+}
+
+void *
+__wrap_realloc(
+        void * pointer,
+        size_t size )
+{
+
+        void *moved = __real_realloc(pointer, size);
+        if( moved == NULL && size != 0 ) {
+                _viwerr_wrap_failed("realloc");
+        }
+        return moved;
+
+}
+
+int
+__wrap_socket(
+        int domain,
+        int type,
+        int protocol )
+{
+
+        int fd = __real_socket(domain, type, protocol);
+        if( fd == -1 ) {
+                _viwerr_wrap_failed("socket");
+        }
+        return fd;
+
+}
+
+int
+__wrap_bind(
+        int fd,
+        const struct sockaddr * address,
+        socklen_t length )
+{
+
+        int result = __real_bind(fd, address, length);
+        if( result == -1 ) {
+                _viwerr_wrap_failed("bind");
+        }
+        return result;
+
+}
+
+int
+__wrap_listen(
+        int fd,
+        int backlog )
+{
+
+        int result = __real_listen(fd, backlog);
+        if( result == -1 ) {
+                _viwerr_wrap_failed("listen");
+        }
+        return result;
+
+}
+
+int
+__wrap_accept(
+        int fd,
+        struct sockaddr * address,
+        socklen_t * length )
+{
+
+        int result = __real_accept(fd, address, length);
+        if( result == -1 ) {
+                _viwerr_wrap_failed("accept");
+        }
+        return result;
+
+}
+
+int
+__wrap_connect(
+        int fd,
+        const struct sockaddr * address,
+        socklen_t length )
+{
+
+        int result = __real_connect(fd, address, length);
+        if( result == -1 ) {
+                _viwerr_wrap_failed("connect");
+        }
+        return result;
+
+}
+
+ssize_t
+__wrap_send(
+        int fd,
+        const void * buffer,
+        size_t size,
+        int flags )
+{
+
+        ssize_t result = __real_send(fd, buffer, size, flags);
+        if( result == -1 ) {
+                _viwerr_wrap_failed("send");
+        }
+        return result;
+
+}
+
+ssize_t
+__wrap_recv(
+        int fd,
+        void * buffer,
+        size_t size,
+        int flags )
+{
+
+        ssize_t result = __real_recv(fd, buffer, size, flags);
+        if( result == -1 ) {
+                _viwerr_wrap_failed("recv");
+        }
+        return result;
+
+}
+#endif /** @c VIWERR_WRAP */
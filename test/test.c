@@ -0,0 +1,314 @@
+/**
+ * @brief
+ * Run with make test, make test THREAD_SAFE=1 or make test
+ * THREAD_RINGS=1. Every check prints its name & the amount
+ * of failures, the exit code is 1 if any check failed.
+ *
+ *      fresh:  a filter on a name or group no package had
+ *              before finds the package pushed with it.
+ *      batch:  viwerr_pop_batch(5) copies the strings the
+ *              ring holds into the buffers it is given.
+ *      frame:  dropping a frame keeps the packages other
+ *              threads pushed meanwhile (thread safe build).
+ *      stress: packages & strings a thread got from
+ *              viwerr(VIWERR_POP...), viwerr_iter_next(1) &
+ *              viwerr_pop_batch(5) stay intact while other
+ *              threads keep pushing into a small ring (thread
+ *              safe build).
+ */
+#define REMOVE_ERRNO_REDEFINE
+#include "../viwerr.h"
+#ifdef VIWERR_INBOX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#define TEST_ROUNDS  2000
+#define TEST_PUSHERS 3
+#define TEST_YIELDS  4
+
+static int test_failed = 0;
+
+static void
+test_report(
+        const char * name,
+        int          failures )
+{
+
+        printf("%-8s %s (%d failures)\n",
+                name, failures == 0 ? "ok" : "FAILED", failures);
+        test_failed |= failures != 0;
+
+}
+
+static void
+test_fresh(
+        void )
+{
+
+        int failures = 0;
+
+        viwerr(VIWERR_PUSH, &(viwerr_package){
+                .code  = 1,
+                .group = (char*)"test_fresh_group"
+        });
+        if( viwerr(VIWERR_OCCURED|VIWERR_BY_GROUP, &(viwerr_package){
+                .group = (char*)"test_fresh_group"
+        }) == NULL ) {
+                failures++;
+        }
+
+        viwerr(VIWERR_PUSH, &(viwerr_package){
+                .code = 2,
+                .name = (char*)"TEST_FRESH_NAME"
+        });
+        if( viwerr(VIWERR_POP|VIWERR_BY_NAME, &(viwerr_package){
+                .name = (char*)"TEST_FRESH_NAME"
+        }) == NULL ) {
+                failures++;
+        }
+
+        viwerr(VIWERR_FLUSH, NULL);
+        test_report("fresh", failures);
+
+}
+
+static void
+test_batch(
+        void )
+{
+
+        int failures = 0;
+        viwerr_package packages[4];
+        viwerr_buffers buffers[4];
+        char message[32];
+        int i;
+
+        for( i = 0; i < 4; i++ ) {
+                snprintf(message, sizeof(message), "batch %d", i);
+                viwerr(VIWERR_PUSH, &(viwerr_package){
+                        .code    = i,
+                        .message = message
+                });
+        }
+
+        size_t popped = viwerr_pop_batch(
+                VIWERR_POP, NULL, packages, buffers, 4
+        );
+        if( popped != 4 ) {
+                failures++;
+        }
+
+        /**
+         * @brief
+         * Overwrite every slot the packages came from, their
+         * strings must not change.
+         */
+        for( i = 0; i < (int)VIWERR_PACKAGE_AMOUNT; i++ ) {
+                viwerr(VIWERR_PUSH, &(viwerr_package){
+                        .code    = -1,
+                        .message = (char*)"overwritten"
+                });
+        }
+
+        for( i = 0; i < (int)popped; i++ ) {
+                snprintf(message, sizeof(message), "batch %d",
+                        packages[i].code);
+                if( strcmp(packages[i].message, message) ) {
+                        failures++;
+                }
+        }
+
+        viwerr(VIWERR_FLUSH, NULL);
+        test_report("batch", failures);
+
+}
+
+#ifdef VIWERR_INBOX
+static volatile int test_stop = 0;
+
+static void *
+test_frame_worker(
+        void * data )
+{
+
+        (void)data;
+        viwerr(VIWERR_PUSH, &(viwerr_package){ .code = 77 });
+        return NULL;
+
+}
+
+static void
+test_frame(
+        void )
+{
+
+        int failures = 0;
+        pthread_t thread;
+
+        viwerr_frame frame = viwerr_frame_begin();
+        viwerr(VIWERR_PUSH, &(viwerr_package){ .code = 1 });
+        pthread_create(&thread, NULL, test_frame_worker, NULL);
+        pthread_join(thread, NULL);
+        viwerr(VIWERR_PUSH, &(viwerr_package){ .code = 2 });
+        viwerr_frame_end(&frame, true);
+
+        if( viwerr(VIWERR_OCCURED|VIWERR_BY_CODE,
+                &(viwerr_package){ .code = 77 }) == NULL ) {
+                failures++;
+        }
+        if( viwerr(VIWERR_OCCURED|VIWERR_BY_CODE,
+                &(viwerr_package){ .code = 1 }) != NULL
+        ||  viwerr(VIWERR_OCCURED|VIWERR_BY_CODE,
+                &(viwerr_package){ .code = 2 }) != NULL ) {
+                failures++;
+        }
+
+        viwerr(VIWERR_FLUSH, NULL);
+        test_report("frame", failures);
+
+}
+
+static void *
+test_stress_pusher(
+        void * data )
+{
+
+        char message[32];
+        int i = 0;
+
+        (void)data;
+        while( !__atomic_load_n(&test_stop, __ATOMIC_RELAXED) ) {
+                snprintf(message, sizeof(message), "other %d", i++);
+                viwerr(VIWERR_PUSH, &(viwerr_package){
+                        .code    = 9,
+                        .name    = (char*)"OTHER",
+                        .message = message
+                });
+
+                /**
+                 * @brief
+                 * Take the lock so the pushes reach the ring
+                 * while the main thread holds its packages.
+                 */
+                viwerr(VIWERR_OCCURED|VIWERR_NO_ERRNO_TRIGGER, NULL);
+        }
+        return NULL;
+
+}
+
+/**
+ * @brief
+ * Let the other threads run for a while, then check that
+ * @b package still is one of this thread whose message fits
+ * its code. Which one it is depends on what the other
+ * threads overwrote.
+ */
+static int
+test_stress_hold(
+        const viwerr_package * package )
+{
+
+        char message[32];
+        int yield;
+        for( yield = 0; yield < TEST_YIELDS; yield++ ) {
+                sched_yield();
+        }
+
+        snprintf(message, sizeof(message), "mine %d", package->code);
+        return strcmp(package->name, "MINE")
+            || strcmp(package->message, message);
+
+}
+
+static void
+test_stress_push(
+        int round )
+{
+
+        char message[32];
+
+        snprintf(message, sizeof(message), "mine %d", round);
+        viwerr(VIWERR_PUSH, &(viwerr_package){
+                .code    = round,
+                .name    = (char*)"MINE",
+                .message = message
+        });
+
+}
+
+static void
+test_stress(
+        void )
+{
+
+        int failures = 0;
+        pthread_t pushers[TEST_PUSHERS];
+        int round, i;
+
+        viwerr_configure(&(viwerr_config){ .capacity = 4 });
+        for( i = 0; i < TEST_PUSHERS; i++ ) {
+                pthread_create(&pushers[i], NULL, test_stress_pusher, NULL);
+        }
+
+        viwerr_filter mine;
+        viwerr_filter_compile(&mine, VIWERR_BY_NAME,
+                &(viwerr_package){ .name = (char*)"MINE" });
+
+        for( round = 0; round < TEST_ROUNDS; round++ ) {
+
+                test_stress_push(round);
+                viwerr_package *package = viwerr(
+                        VIWERR_POP|VIWERR_BY_FILTER, &mine
+                );
+                if( package != NULL ) {
+                        failures += test_stress_hold(package);
+                }
+
+                test_stress_push(round);
+                viwerr_iter iter;
+                viwerr_iter_begin(&iter, &mine, false);
+                package = viwerr_iter_next(&iter);
+                if( package != NULL ) {
+                        failures += test_stress_hold(package);
+                }
+
+                test_stress_push(round);
+                viwerr_package packages[1];
+                viwerr_buffers buffers[1];
+                if( viwerr_pop_batch(VIWERR_POP, &mine,
+                        packages, buffers, 1) == 1 ) {
+                        failures += test_stress_hold(&packages[0]);
+                }
+
+        }
+
+        __atomic_store_n(&test_stop, 1, __ATOMIC_RELAXED);
+        for( i = 0; i < TEST_PUSHERS; i++ ) {
+                pthread_join(pushers[i], NULL);
+        }
+
+        viwerr_configure(&(viwerr_config){
+                .capacity = VIWERR_PACKAGE_AMOUNT
+        });
+        viwerr(VIWERR_FLUSH, NULL);
+        test_report("stress", failures);
+
+}
+#endif /** @c VIWERR_INBOX */
+
+int
+main(
+        void )
+{
+
+        test_fresh();
+        test_batch();
+#ifdef VIWERR_INBOX
+        test_frame();
+        test_stress();
+#endif
+
+        return test_failed;
+
+}
@@ -0,0 +1,306 @@
+/**
+ * @brief
+ * Generates the perfect hash tables of src/errnocode.c from
+ * the names src/errnoname.c knows. Reads src/errnocode.c,
+ * replaces everything from the line that defines
+ * _VIWERR_ERRNO_CODE_BUCKETS up to the end of the slot table
+ * & writes the result to stdout:
+ *
+ *      make errnocode        rewrites src/errnocode.c.
+ *      make check-errnocode  fails if it is out of date.
+ *
+ * Names are hashed with _viwerr_hash(3) itself, so the tables
+ * always agree with viwerr_errno_code(1).
+ */
+#define REMOVE_ERRNO_REDEFINE
+#include "../viwerr.h"
+
+#define ERRNOCODE_BUCKETS  64
+#define ERRNOCODE_BITS_MIN 9
+#define ERRNOCODE_BITS_MAX 12
+#define ERRNOCODE_NAMES    1024
+#define ERRNOCODE_LINE     4096
+
+static char *errnocode_names[ERRNOCODE_NAMES];
+static size_t errnocode_amount = 0;
+
+static unsigned char errnocode_displacement[ERRNOCODE_BUCKETS];
+static const char *errnocode_slots[1 << ERRNOCODE_BITS_MAX];
+
+static int
+errnocode_compare(
+        const void * a,
+        const void * b )
+{
+
+        return strcmp(*(char * const *)a, *(char * const *)b);
+
+}
+
+/**
+ * @brief
+ * Collect every name of a "[ENAME] = " entry in @b path,
+ * sorted & without duplicates.
+ */
+static bool
+errnocode_read_names(
+        const char * path )
+{
+
+        FILE *fp = fopen(path, "r");
+        if( fp == NULL ) {
+                fprintf(stderr, "errnocode: can not open %s\n", path);
+                return false;
+        }
+
+        char line[ERRNOCODE_LINE];
+        while( fgets(line, sizeof(line), fp) != NULL ) {
+
+                char *start = strstr(line, "[E");
+                if( start == NULL ) continue;
+                start++;
+
+                size_t length = strspn(
+                        start, "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_"
+                );
+                if( strncmp(start + length, "] = \"", 5) ) continue;
+
+                if( errnocode_amount == ERRNOCODE_NAMES ) {
+                        fprintf(stderr, "errnocode: more than %d names\n",
+                                ERRNOCODE_NAMES);
+                        fclose(fp);
+                        return false;
+                }
+
+                char *name = malloc(length + 1);
+                memcpy(name, start, length);
+                name[length] = '\0';
+                errnocode_names[errnocode_amount++] = name;
+
+        }
+        fclose(fp);
+
+        qsort(errnocode_names, errnocode_amount, sizeof(char*),
+                errnocode_compare);
+
+        size_t i, unique = 0;
+        for( i = 0; i < errnocode_amount; i++ ) {
+                if( unique > 0
+                && !strcmp(errnocode_names[unique - 1], errnocode_names[i]) ) {
+                        free(errnocode_names[i]);
+                        continue;
+                }
+                errnocode_names[unique++] = errnocode_names[i];
+        }
+        errnocode_amount = unique;
+
+        return errnocode_amount > 0;
+
+}
+
+static uint32_t
+errnocode_slot(
+        uint64_t hash,
+        unsigned displacement,
+        int      bits )
+{
+
+        return ((uint32_t)(hash >> 32) * (2u * displacement + 1u))
+             >> (32 - bits);
+
+}
+
+/**
+ * @brief
+ * Choose the displacement of every bucket, largest buckets
+ * first (ties in the order of their first name), as the
+ * smallest one that sends all of its names to free &
+ * distinct slots.
+ */
+static bool
+errnocode_build(
+        int bits )
+{
+
+        size_t size[ERRNOCODE_BUCKETS] = {0};
+        size_t first[ERRNOCODE_BUCKETS];
+        size_t order[ERRNOCODE_BUCKETS];
+        size_t i, j, k;
+
+        for( i = 0; i < ERRNOCODE_BUCKETS; i++ ) {
+                first[i] = errnocode_amount;
+                order[i] = i;
+        }
+        for( i = 0; i < errnocode_amount; i++ ) {
+                size_t bucket = _viwerr_hash(
+                        errnocode_names[i], VIWERR_NAME_SIZE, NULL
+                ) & (ERRNOCODE_BUCKETS - 1);
+                if( size[bucket]++ == 0 ) first[bucket] = i;
+        }
+
+        for( i = 1; i < ERRNOCODE_BUCKETS; i++ ) {
+                for( j = i; j > 0; j-- ) {
+                        size_t a = order[j - 1], b = order[j];
+                        if( size[a] > size[b]
+                        || (size[a] == size[b] && first[a] < first[b]) )
+                                break;
+                        order[j - 1] = b;
+                        order[j]     = a;
+                }
+        }
+
+        memset(errnocode_slots, 0, sizeof(errnocode_slots));
+        memset(errnocode_displacement, 0, sizeof(errnocode_displacement));
+
+        for( i = 0; i < ERRNOCODE_BUCKETS && size[order[i]] > 0; i++ ) {
+
+                size_t bucket = order[i];
+                unsigned displacement;
+                for( displacement = 0; displacement < 256; displacement++ ) {
+
+                        uint32_t taken[ERRNOCODE_NAMES];
+                        size_t amount = 0;
+                        bool fits = true;
+
+                        for( j = first[bucket]; fits && j < errnocode_amount; j++ ) {
+                                uint64_t hash = _viwerr_hash(
+                                        errnocode_names[j], VIWERR_NAME_SIZE, NULL
+                                );
+                                if( (hash & (ERRNOCODE_BUCKETS - 1)) != bucket )
+                                        continue;
+                                uint32_t slot = errnocode_slot(
+                                        hash, displacement, bits
+                                );
+                                if( errnocode_slots[slot] != NULL ) fits = false;
+                                for( k = 0; fits && k < amount; k++ )
+                                        if( taken[k] == slot ) fits = false;
+                                taken[amount++] = slot;
+                        }
+
+                        if( !fits ) continue;
+
+                        for( j = first[bucket], k = 0; j < errnocode_amount; j++ ) {
+                                uint64_t hash = _viwerr_hash(
+                                        errnocode_names[j], VIWERR_NAME_SIZE, NULL
+                                );
+                                if( (hash & (ERRNOCODE_BUCKETS - 1)) != bucket )
+                                        continue;
+                                errnocode_slots[taken[k++]] = errnocode_names[j];
+                        }
+                        errnocode_displacement[bucket] = (unsigned char)displacement;
+                        break;
+
+                }
+                if( displacement == 256 ) return false;
+
+        }
+
+        return true;
+
+}
+
+static void
+errnocode_print(
+        int bits )
+{
+
+        size_t i;
+
+        printf("#define _VIWERR_ERRNO_CODE_BUCKETS %d\n", ERRNOCODE_BUCKETS);
+        printf("#define _VIWERR_ERRNO_CODE_BITS    %d\n\n", bits);
+
+        printf("static const unsigned char _viwerr_errno_code_displacement[\n"
+               "        _VIWERR_ERRNO_CODE_BUCKETS\n"
+               "] = {\n");
+        for( i = 0; i < ERRNOCODE_BUCKETS; i++ ) {
+                printf("%s%2u%s",
+                        i % 16 == 0 ? "        " : " ",
+                        errnocode_displacement[i],
+                        i + 1 == ERRNOCODE_BUCKETS ? "\n"
+                      : i % 16 == 15 ? ",\n" : ",");
+        }
+        printf("};\n\n");
+
+        printf("static const struct {\n\n"
+               "        const char *name;\n"
+               "        int         code;\n\n"
+               "} _viwerr_errno_code_slots[1 << _VIWERR_ERRNO_CODE_BITS] = {\n");
+        for( i = 0; i < ((size_t)1 << bits); i++ ) {
+                if( errnocode_slots[i] == NULL ) continue;
+                printf("#ifdef %s\n        [%zu] = { \"%s\", %s },\n#endif\n",
+                        errnocode_slots[i], i,
+                        errnocode_slots[i], errnocode_slots[i]);
+        }
+        printf("};\n");
+
+}
+
+int
+main(
+        int    argc,
+        char * argv[] )
+{
+
+        if( argc != 3 ) {
+                fprintf(stderr, "usage: %s errnoname.c errnocode.c\n", argv[0]);
+                return 1;
+        }
+
+        if( !errnocode_read_names(argv[1]) ) {
+                fprintf(stderr, "errnocode: no names in %s\n", argv[1]);
+                return 1;
+        }
+
+        int bits;
+        for( bits = ERRNOCODE_BITS_MIN; bits <= ERRNOCODE_BITS_MAX; bits++ )
+                if( errnocode_build(bits) ) break;
+        if( bits > ERRNOCODE_BITS_MAX ) {
+                fprintf(stderr, "errnocode: %zu names do not fit %d bits\n",
+                        errnocode_amount, ERRNOCODE_BITS_MAX);
+                return 1;
+        }
+
+        FILE *fp = fopen(argv[2], "r");
+        if( fp == NULL ) {
+                fprintf(stderr, "errnocode: can not open %s\n", argv[2]);
+                return 1;
+        }
+
+        /**
+         * @brief
+         * 0 before the tables, 1 inside of them (skipped until
+         * the slot table closes), 2 after them.
+         */
+        char line[ERRNOCODE_LINE];
+        int part = 0;
+        bool slots = false;
+        while( fgets(line, sizeof(line), fp) != NULL ) {
+
+                if( part == 0
+                && !strncmp(line, "#define _VIWERR_ERRNO_CODE_BUCKETS", 34) ) {
+                        errnocode_print(bits);
+                        part = 1;
+                        continue;
+                }
+
+                if( part == 1 ) {
+                        if( strstr(line, "_viwerr_errno_code_slots[") )
+                                slots = true;
+                        if( slots && !strcmp(line, "};\n") )
+                                part = 2;
+                        continue;
+                }
+
+                fputs(line, stdout);
+
+        }
+        fclose(fp);
+
+        if( part != 2 ) {
+                fprintf(stderr, "errnocode: no tables in %s\n", argv[2]);
+                return 1;
+        }
+
+        return 0;
+
+}
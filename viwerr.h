@@ -164,6 +164,7 @@
 #include <stdarg.h>
 #include <limits.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 
 #ifndef VIWERR_INCLUDE
@@ -177,51 +178,41 @@ extern "C" {
 
 /**
  * @brief
- * https://stackoverflow.com/questions/4421681/how-to-
- * count-the-number-of-arguments-passed-to-a-function-
- * that-accepts-a-variabl
- *
- * This is the only thing i have no idea how to explain other
- * than black magic & it works.
- *
- * After using this argument counter ive come to realize that
- * it just counts the , symbols xD.
+ * Define VIWERR_THREAD_SAFE when building the library
+ * (make THREAD_SAFE=1) & before including this header to
+ * make viwerr safe to use from several threads. Pushes go
+ * through a lock-free inbox, everything else takes a lock,
+ * see @c _viwerr_inbox_st. Needs the __atomic builtins &
+ * __thread of GCC or Clang.
+ *
+ * VIWERR_THREAD_RINGS (make THREAD_RINGS=1) implies it &
+ * gives every thread a package ring of its own instead,
+ * only the intern table is shared. No inbox & no lock is
+ * needed then, see @c viwerr_threads_walk(3).
  */
-#define VIWERR_VARCNT_NARG(...) \
-        VIWERR_VARCNT_NARG_(__VA_ARGS__,VIWERR_VARCNT_PP_RSEQ_N())
-
-#define VIWERR_VARCNT_NARG_(...) \
-        VIWERR_VARCNT_128TH_ARG(__VA_ARGS__)
+#if defined(VIWERR_THREAD_RINGS) && !defined(VIWERR_THREAD_SAFE)
+#define VIWERR_THREAD_SAFE
+#endif
 
-#define VIWERR_VARCNT_128TH_ARG(                           \
-         _1,   _2,  _3,  _4,  _5,  _6,  _7,  _8,  _9, _10, \
-        _11,  _12, _13, _14, _15, _16, _17, _18, _19, _20, \
-        _21,  _22, _23, _24, _25, _26, _27, _28, _29, _30, \
-        _31,  _32, _33, _34, _35, _36, _37, _38, _39, _40, \
-        _41,  _42, _43, _44, _45, _46, _47, _48, _49, _50, \
-        _51,  _52, _53, _54, _55, _56, _57, _58, _59, _60, \
-        _61,  _62, _63, _64, _65, _66, _67, _68, _69, _70, \
-        _71,  _72, _73, _74, _75, _76, _77, _78, _79, _80, \
-        _81,  _82, _83, _84, _85, _86, _87, _88, _89, _90, \
-        _91,  _92, _93, _94, _95, _96, _97, _98, _99,_100, \
-        _101,_102,_103,_104,_105,_106,_107,_108,_109,_110, \
-        _111,_112,_113,_114,_115,_116,_117,_118,_119,_120, \
-        _121,_122,_123,_124,_125,_126,_127,N,...) N
+#ifdef VIWERR_THREAD_SAFE
+#ifndef __GNUC__
+#error "viwerr: VIWERR_THREAD_SAFE needs GCC or Clang."
+#endif
+#define VIWERR_THREAD_LOCAL __thread
+#else
+#define VIWERR_THREAD_LOCAL
+#endif
 
-#define VIWERR_VARCNT_PP_RSEQ_N()                \
-        127,126,125,124,123,122,121,120,         \
-        119,118,117,116,115,114,113,112,111,110, \
-        109,108,107,106,105,104,103,102,101,100, \
-         99, 98, 97, 96, 95, 94, 93, 92, 91, 90, \
-         89, 88, 87, 86, 85, 84, 83, 82, 81, 80, \
-         79, 78, 77, 76, 75, 74, 73, 72, 71, 70, \
-         69, 68, 67, 66, 65, 64, 63, 62, 61, 60, \
-         59, 58, 57, 56, 55, 54, 53, 52, 51, 50, \
-         49, 48, 47, 46, 45, 44, 43, 42, 41, 40, \
-         39, 38, 37, 36, 35, 34, 33, 32, 31, 30, \
-         29, 28, 27, 26, 25, 24, 23, 22, 21, 20, \
-         19, 18, 17, 16, 15, 14, 13, 12, 11, 10, \
-          9,  8,  7,  6,  5,  4,  3,  2,  1,  0
+#if defined(VIWERR_THREAD_SAFE) && !defined(VIWERR_THREAD_RINGS)
+#define VIWERR_INBOX
+#define VIWERR_RING_LOCAL
+#define VIWERR_LOCK()       _viwerr_lock()
+#define VIWERR_UNLOCK()     _viwerr_unlock()
+#else
+#define VIWERR_RING_LOCAL   VIWERR_THREAD_LOCAL
+#define VIWERR_LOCK()
+#define VIWERR_UNLOCK()
+#endif
 
 /**
  * @brief
@@ -239,17 +230,17 @@ extern "C" {
  * Depending on the function we use it in this constant
  * will do something different.
  *
- *      @tparam @c _viwerr_list(4,5)
+ *      @tparam @c _viwerr_push(5)
  *      In this function VIWERR_PUSH indicated that we need to
  *      place the interlinked package into the array.
  *      (interlinked: passed together into the function).
  *
  *      @tparam @c viwerr(1,2)
  *      In this function VIWERR_PUSH and its interlinked package are both
- *      passed to _viwerr_list(4,5). (interlinked: passed together
+ *      passed to _viwerr_push(5). (interlinked: passed together
  *      into the function).
  *
- *      @param @b _viwerr_list(VIWERR_PUSH,&(viwerr_package){...})
+ *      @param @b viwerr_push(0,&(viwerr_package){...})
  *
  *      @param @b viwerr(VIWERR_PUSH,&(viwerr_package){...})
  *
@@ -270,17 +261,17 @@ extern "C" {
  * Depending on the function we use it in this constant
  * will do something different.
  *
- *      @tparam @c _viwerr_list(4,5)
+ *      @tparam @c _viwerr_pop(5)
  *      In this function VIWERR_POP returns a package, depending on
  *      if any other arguments were included the package returned may
  *      vary.
  *
  *      @tparam @c viwerr(1,2)
- *      Just a direct call to _viwerr_list(4,5) with the same parameters.
+ *      Just a direct call to _viwerr_pop(5) with the same parameters.
  *
- *      @param @b _viwerr_list(VIWERR_POP,NULL);
+ *      @param @b viwerr_pop(0,NULL);
  *
- *      @param @b _viwerr_list(VIWERR_POP|VIWERR_BY...,&(viwerr_package){...});
+ *      @param @b viwerr_pop(VIWERR_BY...,&(viwerr_package){...});
  *
  *      @param @b viwerr(VIWERR_POP,NULL);
  *
@@ -337,13 +328,65 @@ extern "C" {
  */
 #define VIWERR_ADRESS_ONLY   1<<16
 
+/**
+ * @brief
+ * Used in combination with @c VIWERR_PUSH.
+ * The name, message & group strings of the pushed package
+ * live until the program exits (string literals, static
+ * buffers...), viwerr stores their pointers instead of
+ * copying or interning them.
+ *
+ *      @param @b viwerr(VIWERR_PUSH|VIWERR_STATIC,&(viwerr_package){...})
+ *
+ */
+#define VIWERR_STATIC        1<<17
+
+/**
+ * @brief
+ * Used in combination with @c VIWERR_PUSH.
+ * Same as @c VIWERR_STATIC but for the file & function
+ * strings. @a viwerr(2) always sets it because __FILE__
+ * and __func__ live until the program exits, @a viwerr_file(4)
+ * leaves it to the caller.
+ */
+#define VIWERR_STATIC_LOCATION 1<<18
+
+/**
+ * @brief
+ * Used in combination with @c VIWERR_PUSH.
+ * Same as @c VIWERR_STATIC but only for the message, the
+ * name & group are still interned. Set by viwerr itself
+ * for errno packages whose message comes from the table
+ * of @c _viwerr_errno_message(1).
+ */
+#define VIWERR_STATIC_MESSAGE 1<<20
+
+/**
+ * @brief
+ * Used in combination with @c VIWERR_POP, @c VIWERR_PRINT,
+ * @c VIWERR_OCCURED & @c VIWERR_FLUSH instead of the VIWERR_BY...
+ * family. The argument is a @c viwerr_filter compiled with
+ * @c viwerr_filter_compile(3) instead of a package.
+ *
+ *      @param @b viwerr(VIWERR_POP|VIWERR_BY_FILTER,&filter)
+ *
+ */
+#define VIWERR_BY_FILTER     1<<19
+
 /**
  * @brief
  * Amount of packages that are constructed when
- * the program is initalized.
+ * the program is initalized. Can be changed at runtime
+ * with @c viwerr_configure(1). Always a power of two.
  */
 #define VIWERR_PACKAGE_AMOUNT (size_t)128
 
+/**
+ * @brief
+ * Smallest ring capacity @c viwerr_configure(1) accepts.
+ */
+#define VIWERR_PACKAGE_AMOUNT_MIN (size_t)2
+
 /**
  * \ingroup String_Sizes
  * @brief
@@ -362,6 +405,23 @@ extern "C" {
  * @}
  */
 
+/**
+ * \ingroup String_Sizes
+ * @brief
+ * Size of the table that interns the name, group, file
+ * and function strings of pushed packages. Amount of
+ * entries must be a power of two, at most 3/4 of them are
+ * used. Both are allocated statically so pushing never
+ * allocates, once the table is full strings are copied
+ * into the slot like they were before.
+ * @{
+ */
+#define VIWERR_INTERN_AMOUNT     (size_t)512
+#define VIWERR_INTERN_ARENA_SIZE (size_t)(16 * 1024)
+/**
+ * @}
+ */
+
 
 /**
  * @struct  @c viwerr_package_st
@@ -439,9 +499,306 @@ typedef struct viwerr_package_st {
 
 } viwerr_package;
 
+/**
+ * \ingroup Package_States
+ * @brief
+ * Bits of the packed state byte every slot of the ring
+ * has instead of the three int's of viwerr_package.flag.
+ * A package that was pushed but not returned yet has only
+ * VIWERR_STATE_CONTAINS set, see @c VIWERR_STATE_PENDING(1).
+ * @{
+ */
+#define VIWERR_STATE_CONTAINS (uint8_t)(1<<0)
+#define VIWERR_STATE_RETURNED (uint8_t)(1<<1)
+#define VIWERR_STATE_PRINTED  (uint8_t)(1<<2)
+
+#define VIWERR_STATE_PENDING(state)                               \
+        (((state) & (VIWERR_STATE_CONTAINS|VIWERR_STATE_RETURNED)) \
+                == VIWERR_STATE_CONTAINS)
+/**
+ * @}
+ */
+
+/**
+ * @struct  @c _viwerr_buffers_st
+ * @typedef @c _viwerr_buffers
+ *
+ *      @brief Inline string buffers of one slot, used for
+ *      the message & for strings that did not fit into the
+ *      intern table, see @c _viwerr_intern(3).
+ *
+ */
+typedef struct _viwerr_buffers_st {
+
+        char name[VIWERR_NAME_SIZE];
+        char message[VIWERR_MESSAGE_SIZE];
+        char group[VIWERR_GROUP_SIZE];
+        char file[VIWERR_FILENAME_SIZE];
+        char func[VIWERR_FUNCTION_SIZE];
+
+} _viwerr_buffers;
+
+/**
+ * @typedef @c viwerr_buffers
+ *
+ *      @brief String buffers for one package, passed along
+ *      with the packages to @c viwerr_pop_batch(5) so strings
+ *      the ring holds are copied out of it.
+ *
+ */
+typedef _viwerr_buffers viwerr_buffers;
+
+/**
+ * @struct  @c _viwerr_ring_st
+ * @typedef @c _viwerr_ring
+ *
+ *      @brief State of the package ring shared between
+ *      @c _viwerr_push(5), @c viwerr_configure(1) &
+ *      @c _viwerr_list_free(0).
+ *
+ *      Packages are stored as a structure of arrays, slot
+ *      i of the ring is element i of every array. Loops that
+ *      look for a package only stream through the small
+ *      @b state array (and @b code, ids... when filtering),
+ *      the viwerr_package that viwerr(...) returns is written
+ *      into @b view only once the package is returned, see
+ *      @c _viwerr_package_view(2). All arrays are carved out
+ *      of @b block, a single malloc(1) call.
+ *
+ *      @tparam @b state
+ *      Packed VIWERR_STATE... bits, read through
+ *      VIWERR_SLOT_STATE(2).
+ *
+ *      @tparam @b code_head, code_next & code_prev
+ *      Index on the error code. Every slot that is set in
+ *      @b live is linked into the chain of bucket
+ *      VIWERR_CODE_BUCKET(ring, code), so VIWERR_BY_CODE only
+ *      visits packages whose code hashes the same.
+ *
+ *      @tparam @b push_next, push_prev, push_last & sequence
+ *      Every slot that is set in @b live is also linked into
+ *      one list in the order the packages were pushed in,
+ *      @b push_last is the newest. @b sequence is the value
+ *      @b pushed had when the package was pushed, so the list
+ *      is sorted by it. Lets @c viwerr_frame_end(2) find the
+ *      packages a frame pushed without a scan.
+ *
+ *      @tparam @b live
+ *      Bitmap with one bit per slot, set while the slot holds
+ *      a package that was not returned yet. Lets searches skip
+ *      64 empty slots at a time, see @c _viwerr_live_prev(3).
+ *
+ *      @tparam @b code & line
+ *      Error code & line of the package.
+ *
+ *      @tparam @b name_id & group_id
+ *      Intern ids of the name & group, 0 if the string was
+ *      copied into @b buffers or pushed with VIWERR_STATIC.
+ *
+ *      @tparam @b thread
+ *      @c _viwerr_thread_id(0) of the thread that pushed the
+ *      package in the thread safe build, frames only drop the
+ *      packages of their own thread. 0 in the other builds.
+ *
+ *      @tparam @b name_hash, message_hash & group_hash
+ *      @c _viwerr_hash(3) of the strings computed on push, so
+ *      filters only compare strings whose hashes are equal.
+ *
+ *      @tparam @b name, message, group, file & func
+ *      Strings of the package. They point to interned
+ *      strings, static strings or into @b buffers.
+ *
+ *      @tparam @b buffers
+ *      Inline string buffers.
+ *
+ *      @tparam @b view
+ *      Packages handed out by viwerr(...).
+ *
+ *      @tparam @b capacity
+ *      Amount of slots, always a power of two so indexes
+ *      wrap around with @b mask instead of a modulo.
+ *
+ *      @tparam @b mask
+ *      @b capacity - 1.
+ *
+ *      @tparam @b newest
+ *      Index of the slot the last package was pushed into.
+ *
+ *      @tparam @b amount
+ *      Amount of packages that were not returned yet, equal
+ *      to the amount of bits set in @b live.
+ *
+ *      @tparam @b max_capacity
+ *      If larger than @b capacity the ring doubles instead of
+ *      overwriting a package that was not returned yet, until
+ *      it reaches @b max_capacity slots.
+ *
+ *      @tparam @b group_count
+ *      Amount of packages that were not returned yet per
+ *      intern id of their group. Index 0 counts the packages
+ *      whose group is not interned. Stored inside of the
+ *      ring itself so @c viwerr_occured_in_group(1) can read
+ *      it without a call.
+ *
+ *      @tparam @b epoch, generation & group_epoch
+ *      An unfiltered VIWERR_FLUSH only bumps @b epoch, see
+ *      @c _viwerr_ring_flush(1). Slots & group counters whose
+ *      @b generation or @b group_epoch is not @b epoch are
+ *      left over from before it and read as empty. Their live
+ *      bits are cleared once a search reaches them and the
+ *      slots are recycled on push, a chain (or push list)
+ *      whose head is left over is empty.
+ *
+ */
+typedef struct _viwerr_ring_st {
+
+        void            *block;
+
+        uint64_t        *live;
+        size_t          *code_head;
+        size_t          *code_next;
+        size_t          *code_prev;
+        size_t          *push_next;
+        size_t          *push_prev;
+        uint64_t        *sequence;
+        uint64_t        *name_hash;
+        uint64_t        *message_hash;
+        uint64_t        *group_hash;
+        uint8_t         *state;
+        int             *code;
+        int             *line;
+        unsigned        *name_id;
+        unsigned        *group_id;
+        unsigned        *thread;
+        uint32_t        *generation;
+
+        char           **name;
+        char           **message;
+        char           **group;
+        char           **file;
+        char           **func;
+
+        _viwerr_buffers *buffers;
+        viwerr_package  *view;
+
+        size_t           capacity;
+        size_t           mask;
+        size_t           newest;
+        size_t           amount;
+        size_t           max_capacity;
+        uint32_t         epoch;
+        uint64_t         pushed;
+        size_t           push_last;
+
+        size_t           group_count[VIWERR_INTERN_AMOUNT + 1];
+        uint32_t         group_epoch[VIWERR_INTERN_AMOUNT + 1];
+
+} _viwerr_ring;
+
+/**
+ * @brief
+ * Index that marks the end of a chain, or a slot that
+ * was not found.
+ */
+#define VIWERR_NONE (size_t)-1
+
+/**
+ * @brief
+ * Bucket of the code index that @b code belongs to.
+ */
+#define VIWERR_CODE_BUCKET(ring, code) \
+        ((size_t)((uint32_t)(code) * 2654435761u) & (ring)->mask)
+
+/**
+ * @brief
+ * State of slot @b index, empty if the slot is left over
+ * from before the last unfiltered VIWERR_FLUSH.
+ */
+#define VIWERR_SLOT_STATE(ring, index)                          \
+        ((ring)->generation[index] == (ring)->epoch ?           \
+                (ring)->state[index] :                          \
+                (uint8_t)(VIWERR_STATE_RETURNED|VIWERR_STATE_PRINTED))
+
+/**
+ * @fn @c _viwerr_code_first(2)
+ *
+ *      @brief First slot of the chain of @b code in the code
+ *      index. Chains only ever link slots of the current epoch,
+ *      so only the head can be left over from before the last
+ *      unfiltered VIWERR_FLUSH.
+ *
+ *      @return Index of the slot or VIWERR_NONE.
+ *
+ */
+static inline size_t
+_viwerr_code_first(
+        const _viwerr_ring * ring,
+        int code )
+{
+
+        size_t head = ring->code_head[VIWERR_CODE_BUCKET(ring, code)];
+
+        return head != VIWERR_NONE
+            && ring->generation[head] == ring->epoch ?
+                head : VIWERR_NONE;
+
+}
+
+/**
+ * @brief
+ * Amount of 64 bit words the live bitmap of a ring with
+ * @b capacity slots needs.
+ */
+#define VIWERR_LIVE_WORDS(capacity) \
+        (((capacity) + 63) / 64)
+
+/**
+ * @brief
+ * Amount of memory one slot of the ring takes up, not
+ * counting its bit in the live bitmap.
+ */
+#define VIWERR_SLOT_SIZE                                \
+        (sizeof(viwerr_package) + sizeof(_viwerr_buffers) \
+        + 5 * sizeof(char*) + 2 * sizeof(int)            \
+        + 3 * sizeof(unsigned) + 5 * sizeof(size_t)      \
+        + 4 * sizeof(uint64_t) + sizeof(uint32_t)        \
+        + sizeof(uint8_t))
+
+/**
+ * @struct  @c viwerr_config_st
+ * @typedef @c viwerr_config
+ *
+ *      @brief Settings passed to @c viwerr_configure(1).
+ *
+ *      @tparam @b capacity
+ *      Amount of packages the ring holds, rounded up to a
+ *      power of two. 0 keeps the current capacity.
+ *
+ *      @tparam @b grow
+ *      If true the ring doubles in size instead of
+ *      overwriting the oldest package that was not returned
+ *      yet. Packages keep their order when the ring grows.
+ *      Note that growing allocates memory inside of
+ *      viwerr(VIWERR_PUSH, ...), if that fails the oldest
+ *      package is overwritten like it would be without
+ *      @b grow.
+ *
+ *      @tparam @b max_capacity
+ *      Upper limit for @b grow, 0 means no limit.
+ *
+ */
+typedef struct viwerr_config_st {
+
+        size_t capacity;
+        bool   grow;
+        size_t max_capacity;
+
+} viwerr_config;
+
 /**
  * @brief
- * Amount of memory the viwerr_package array uses.
+ * Amount of memory the package ring uses with its
+ * default capacity.
  * The viwerr array is used due to the fact that
  * the viwerr function should not be able to return any
  * errors other than syntax errors. If the computer runs
@@ -449,9 +806,9 @@ typedef struct viwerr_package_st {
  * a new package it's not gonna go well so we have to
  * use a package from a predefined list of packages.
  */
-#define VIWERR_MEMORY_USED                                            \
-        (VIWERR_NAME_SIZE + VIWERR_MESSAGE_SIZE + VIWERR_GROUP_SIZE + \
-        sizeof(viwerr_package)) * VIWERR_PACKAGE_AMOUNT
+#define VIWERR_MEMORY_USED                       \
+        (VIWERR_SLOT_SIZE * VIWERR_PACKAGE_AMOUNT \
+        + VIWERR_LIVE_WORDS(VIWERR_PACKAGE_AMOUNT) * sizeof(uint64_t))
 
 /**
  * @brief
@@ -507,11 +864,23 @@ typedef struct viwerr_package_st {
         .flag.contains = 1                    \
 }
 
+/**
+ * @brief
+ * The package ring. Use @c _viwerr_list_init(0) to get
+ * it, it makes sure the ring was allocated. Only exposed
+ * so header functions like @c viwerr_occured_in_group(1)
+ * can be inlined. With VIWERR_THREAD_RINGS every thread
+ * has its own.
+ */
+extern VIWERR_RING_LOCAL _viwerr_ring _viwerr_ring_global;
+
 /**
  * @fn @c _viwerr_list_init(0)
  *
- *      @brief Initalize a viwerr_package array with
- *      default values & return it.
+ *      @brief Initalize the package ring with default values
+ *      & return it. The ring is one block of memory holding
+ *      VIWERR_PACKAGE_AMOUNT slots, see @c _viwerr_ring,
+ *      unless @c viwerr_configure(1) was called.
  *
  *
  *      @throw @b ENOMEM - Exits program forcefully if upon startup
@@ -519,231 +888,1928 @@ typedef struct viwerr_package_st {
  *                      occupied.
  *
  *
- *      @return Initalized viwerr_package* array.
+ *      @return Initalized package ring, @c _viwerr_ring_global.
  *
  */
 #ifdef __GNUC__
 __attribute__((constructor))
 #endif
-viwerr_package**
+_viwerr_ring*
 _viwerr_list_init(
         void
 );
 
-
-#ifdef __GNUC__
-__attribute__((destructor))
-#endif
-void
-_viwerr_list_free(
-    void
-);
-
 /**
- * @fn @c _viwerr_popcnt(1)
+ * @fn @c _viwerr_ring_alloc(2)
  *
- *      @brief Simple bit counter.
+ *      @brief Allocate the block for @b capacity empty slots
+ *      and point the arrays of @b ring into it. Only the
+ *      arrays, @b block, @b capacity & @b mask are written.
  *
  *
- *      @param @b arg
- *                Integer value we count bits from.
+ *      @param @b ring
+ *                Ring whose arrays are set.
  *
+ *      @param @b capacity
+ *                Amount of slots, must be a power of two.
  *
- *      @returns Count of bits inside @b arg that are
- *      set to 1.
+ *
+ *      @return false if malloc(1) failed, @b ring is left
+ *      untouched in that case.
  *
  */
-long _viwerr_popcnt(
-        long arg
+bool
+_viwerr_ring_alloc(
+        _viwerr_ring * ring,
+        size_t capacity
 );
 
 /**
- * @fn @c _viwerr_filter_by(3)
- *
- *      @brief
- *      Filter a package by the filters arguments
- *      VIWERR_BY...
+ * @fn @c _viwerr_live_set(3)
  *
+ *      @brief Set or clear the bit of slot @b index in the
+ *      live bitmap & keep @b ring->amount, the code index and
+ *      the group counters in sync with it. The code & group
+ *      id of the slot must not change while its bit is set.
  *
- *      @param @b arg
- *                Arguments that contains one of the
- *                arguments from the VIWERR_BY... family.
+ */
+void
+_viwerr_live_set(
+        _viwerr_ring * ring,
+        size_t index,
+        bool live
+);
+
+/**
+ * @fn @c _viwerr_live_prev(3)
  *
- *      @param @b package
- *                Package we will compare/filter with our
- *                filter package.
+ *      @brief Walk the ring backwards from slot @b from
+ *      (included) until a slot with a package that was not
+ *      returned yet is found, a word of the live bitmap at
+ *      a time.
  *
- *      @param @b filter
- *                Error package from which we take certaint parts
- *                from to use as a filter.
  *
+ *      @param @b ring
+ *                Ring to search.
  *
- *      @throw Nothing.
+ *      @param @b from
+ *                Index of the first slot checked.
  *
+ *      @param @b limit
+ *                Maximum amount of slots to walk.
  *
- *      @return Integer boolean value of 0 or 1 that will
- *      tell us if the package passed throught the filter.
  *
+ *      @return Distance d from @b from to the found slot,
+ *      (from - d) & mask, or @b limit if none was found.
  *
  */
-bool
-_viwerr_filter_by(
-        int arg,
-        const char * file,
-        int line,
-        viwerr_package * package,
-        viwerr_package * filter
+size_t
+_viwerr_live_prev(
+        _viwerr_ring * ring,
+        size_t from,
+        size_t limit
 );
 
-
 /**
- * @fn @c _viwerr_clear_package(1)
+ * @fn @c _viwerr_live_next(3)
  *
- *      @brief Set package variables to that of @b viwerr_package_empty.
+ *      @brief @c _viwerr_live_prev(3) walking forwards.
  *
  *
- *      @param @b package
- *                Package to reset.
+ *      @return Distance d from @b from to the found slot,
+ *      (from + d) & mask, or @b limit if none was found.
  *
+ */
+size_t
+_viwerr_live_next(
+        _viwerr_ring * ring,
+        size_t from,
+        size_t limit
+);
+
+/**
+ * @fn @c _viwerr_package_view(2)
  *
- *      @throw Nothing.
+ *      @brief Write the package in slot @b index into
+ *      @b ring->view[index] & return it.
  *
+ */
+viwerr_package*
+_viwerr_package_view(
+        _viwerr_ring * ring,
+        size_t index
+);
+
+/**
+ * @fn @c _viwerr_package_copy_into(4)
  *
- *      @returns Nothing.
+ *      @brief Copy @b package, a view of @b ring, into
+ *      @b into. Strings that point into @b ring->buffers are
+ *      copied into @b buffers, interned & static strings
+ *      outlive the slot and are kept as they are.
  *
  */
-void _viwerr_clear_package(
-        viwerr_package * package
+void
+_viwerr_package_copy_into(
+        _viwerr_ring *         ring,
+        const viwerr_package * package,
+        viwerr_package *       into,
+        viwerr_buffers *       buffers
 );
 
+#ifdef VIWERR_INBOX
 /**
- * @brief Prints the contents of a viwerr_package.
+ * @fn @c _viwerr_package_copy(2)
+ *
+ *      @brief @c _viwerr_package_copy_into(4) into a package
+ *      of the calling thread, returned. Called with the lock
+ *      held, so another thread's push can not overwrite what
+ *      the caller got once the lock is released.
+ *
  */
-void
-_viwerr_print_package(
+viwerr_package*
+_viwerr_package_copy(
+        _viwerr_ring *   ring,
         viwerr_package * package
 );
+#endif
 
 /**
- * @fn @c _viwerr_list(4,5)
+ * @fn @c _viwerr_ring_resize(2)
  *
- *      @brief
- *      Sort of interface function through which we interact
- *      with the error package array.
+ *      @brief Move the ring into a new block of @b capacity
+ *      slots. Packages keep their order, if @b capacity is
+ *      smaller than the current one only the newest packages
+ *      are kept. Packages returned by viwerr(...) before the
+ *      resize are no longer valid afterwards.
  *
- *      @param @b arg
- *                Arguments passed through that will indicate
- *                what we want to do to the list.
- *                Possible arguments are:
- *                      Only one of the following arguments are allowed
- *                      per call.
- *                VIWERR_EDIT, VIWERR_FLUSH, VIWERR_POP & VIWERR_PUSH.
- *                      The rest only matter if the prior arguments say
- *                      that they do.
  *
+ *      @param @b ring
+ *                Ring to resize.
+ *
+ *      @param @b capacity
+ *                New amount of slots, must be a power of two.
+ *
+ *
+ *      @return true on success, false if malloc(1) failed in
+ *      which case the ring is left untouched.
  *
  */
-viwerr_package*
-_viwerr_list(
-        int          arg,
-        char*       func,
-        const char *file,
-        int         line,
-        int          cnt,
-        ...
+bool
+_viwerr_ring_resize(
+        _viwerr_ring * ring,
+        size_t capacity
 );
 
 /**
- * @def @a viwerr_list(2)
+ * @fn @c _viwerr_ring_flush(1)
  *
- *      @brief _viwerr_list(4,5) with argument 'cnt' counted by
- *      @a VIWERR_VARCNT_NARG(1). Also automatically inserts the
- *      __FILE__ and __LINE__ into file and line arguments.
+ *      @brief Flush every package of @b ring by starting a new
+ *      epoch, in constant time. Slots of the old epoch are
+ *      recycled lazily, see @c _viwerr_ring_st. Only once the
+ *      epoch wraps around are all slots reset at once.
  *
  */
-#define viwerr(arg, ...)                         \
-        _viwerr_list(                            \
-                arg/*|(errno<<64)*/,             \
-                (char*)__func__,                 \
-                __FILE__,                        \
-                __LINE__,                        \
-                VIWERR_VARCNT_NARG(__VA_ARGS__), \
-                __VA_ARGS__)
+void
+_viwerr_ring_flush(
+        _viwerr_ring * ring
+);
 
+#ifdef VIWERR_INBOX
 /**
- * @def @a viwerr_file(4)
+ * @brief
+ * Amount of cells in the inbox, must be a power of two.
+ */
+#ifndef VIWERR_INBOX_AMOUNT
+#define VIWERR_INBOX_AMOUNT (size_t)64
+#endif
+
+/**
+ * @struct  @c _viwerr_inbox_cell_st
+ * @typedef @c _viwerr_inbox_cell
  *
- *      @brief viwerr_file(4) is viwerr(2) with file and line
- *      being insertable.
+ *      @brief A package pushed into the inbox, its strings
+ *      point into @b buffers unless they were pushed with
+ *      VIWERR_STATIC or VIWERR_STATIC_LOCATION.
+ *
+ *      @tparam @b sequence
+ *      Ticket t of the push that may write the cell while
+ *      it is free, t + 1 once the package is published.
+ *
+ *      @tparam @b thread
+ *      @c _viwerr_thread_id(0) of the pushing thread, the
+ *      package is moved into the ring by whoever drains.
  *
  */
-#define viwerr_file(arg, func, file, line, ...)  \
-        _viwerr_list(                            \
-                arg,                             \
-                (char*)func,                     \
-                file,                            \
-                line,                            \
-                VIWERR_VARCNT_NARG(__VA_ARGS__), \
-                __VA_ARGS__)
+typedef struct _viwerr_inbox_cell_st {
 
-#define VIWERR_ERRNO_FLUSH
+        size_t          sequence;
+        int             arg;
+        int             code;
+        int             line;
+        unsigned        thread;
 
-#define viwerr_occured_in_group(gr) \
-        (viwerr(VIWERR_OCCURED, &(viwerr_package){.group=(char*)gr}) ? true : false)
+        char           *name;
+        char           *message;
+        char           *group;
+        char           *file;
+        char           *func;
+
+        _viwerr_buffers buffers;
+
+} _viwerr_inbox_cell;
 
 /**
- * @fn @c viwerr_errno_redefine(2)
+ * @struct  @c _viwerr_inbox_st
+ * @typedef @c _viwerr_inbox
  *
- *      @brief This function allows viwerr to be updated
- *      on the state of errno every time errno is called.
- *      Due to the C preprocessor reading files line by line,
- *      the errno calls inside this function are of the orginal
- *      errno from <errno.h>. Afterwards errno is redefined
- *      to call this function instead of whatever was
- *      inside of errno before. Due to this function returning the
- *      original errno macro, we can use the normal errno
- *      syntax to read and write values to errno.
- *      viwerr is kind of late to the party when it comes to
- *      reading values from errno because we can't make a macro
- *      that keeps the original syntax and also calls a function
- *      after the errno value was called for
- *      reading or writing. Because of that
- *      viwerr is one read behind errno, which means if errno
- *      is changed viwerr won't be notified until errno is called
- *      again. This can be easily mitigated by calling this
- *      function inside of viwerr but the problem lies not in
- *      the latency but in the fact that we cannot determine
- *      on any call to errno wether the value was written to or
- *      read from. Because of that if we have multiple functions
- *      setting errno to the same value we will only store the
- *      errno value from the first function that set it to that
- *      particular value.
+ *      @brief Lock-free multi-producer ring in front of the
+ *      package ring of the thread safe build. A push takes a
+ *      ticket with an atomic fetch-add on @b head, writes the
+ *      cell of the ticket & publishes it through the sequence
+ *      of the cell. Whoever holds the lock moves published
+ *      cells into the package ring in ticket order, see
+ *      @c _viwerr_inbox_drain(0), so nothing ever reads a
+ *      package that is half written.
  *
- *      @returns &(errno) <- errno before it was redefined.
+ *      @tparam @b head
+ *      Next ticket, the only value producers share.
+ *
+ *      @tparam @b tail
+ *      Next ticket to drain, only touched with the lock held.
  *
  */
-int * viwerr_errno_redefine(
-        char*        func,
-        const char * file,
-        int line
-);
+typedef struct _viwerr_inbox_st {
+
+        size_t             head;
+        char               pad[64 - sizeof(size_t)];
+        size_t             tail;
+        _viwerr_inbox_cell cell[VIWERR_INBOX_AMOUNT];
+
+} _viwerr_inbox;
+
+extern _viwerr_inbox _viwerr_inbox_global;
 
 /**
- * @brief
- * If viwerr(VIWERR_PUSH, ...) pushed a errno value
- * viwerr_errno_redefine will ignore the new value as
- * it is already written.
+ * @fn @c _viwerr_inbox_push(5)
+ *
+ *      @brief Copy @b package into a cell of the inbox. Only
+ *      waits if the inbox is full, then it drains it itself.
+ *
  */
-bool viwerr_errno_ignore_new(bool set);
+void
+_viwerr_inbox_push(
+        int              arg,
+        char*            func,
+        const char *     file,
+        int              line,
+        viwerr_package * package
+);
 
-/* SPDX-License-Identifier: 0BSD */
-/* Copyright 2019 Alexander Kozhevnikov <mentalisttraceur@gmail.com> */
-char const * errnoname(int errno_);
+/**
+ * @fn @c _viwerr_inbox_drain(0)
+ *
+ *      @brief Push every published package of the inbox into
+ *      the package ring. The lock must be held.
+ *
+ */
+void
+_viwerr_inbox_drain(
+        void
+);
+
+/**
+ * @fn @c _viwerr_thread_id(0)
+ *
+ *      @brief Id of the calling thread, handed out on its
+ *      first call & never 0.
+ *
+ */
+unsigned
+_viwerr_thread_id(
+        void
+);
+#endif
+
+#ifdef VIWERR_THREAD_SAFE
+/**
+ * @fn @c _viwerr_lock(0) & @c _viwerr_unlock(0)
+ *
+ *      @brief Spinlock around the package ring, a thread that
+ *      holds it can take it again. Taking it drains the inbox
+ *      so the package ring holds every published package.
+ *      Use VIWERR_LOCK() & VIWERR_UNLOCK(), they do nothing in
+ *      the single threaded build. With VIWERR_THREAD_RINGS it
+ *      only guards the intern table & the list of rings.
+ *
+ */
+void
+_viwerr_lock(
+        void
+);
+
+void
+_viwerr_unlock(
+        void
+);
+#endif
+
+/**
+ * @fn @c viwerr_configure(1)
+ *
+ *      @brief Change the capacity & growth mode of the package
+ *      ring. Meant to be called once at startup, calling it
+ *      later keeps the newest packages that fit. With
+ *      VIWERR_THREAD_RINGS it changes the ring of the calling
+ *      thread & of the threads that did not push yet.
+ *
+ *
+ *      @param @b config
+ *                New settings, see @c viwerr_config.
+ *
+ *
+ *      @return true on success, false if @b config is NULL or
+ *      memory for the new ring could not be allocated.
+ *
+ */
+bool
+viwerr_configure(
+        viwerr_config * config
+);
+
+/**
+ * @fn @c _viwerr_list_free(0)
+ *
+ *      @brief Release the package ring allocated by
+ *      @c _viwerr_list_init(0) with a single free(1) call.
+ *
+ */
+#ifdef __GNUC__
+__attribute__((destructor))
+#endif
+void
+_viwerr_list_free(
+    void
+);
+
+/**
+ * @brief
+ * @c _viwerr_hash(3) of an empty string.
+ */
+#define VIWERR_HASH_EMPTY UINT64_C(14695981039346656037)
+
+/**
+ * @fn @c _viwerr_hash(3)
+ *
+ *      @brief 64 bit FNV-1a hash of the first @b size - 1
+ *      characters of @b string, the part that would fit into
+ *      a field of that size. NULL hashes like "".
+ *
+ *
+ *      @param @b length
+ *                If not NULL set to the amount of characters
+ *                that were hashed.
+ *
+ *
+ *      @return Hash of the string.
+ *
+ */
+uint64_t
+_viwerr_hash(
+        const char * string,
+        size_t size,
+        size_t * length
+);
+
+/**
+ * @fn @c _viwerr_hash_copy(3)
+ *
+ *      @brief Copy the part of @b string that fits into
+ *      @b buffer of @b size characters & hash it, a cheaper
+ *      snprintf(buffer, size, "%s", string).
+ *
+ *
+ *      @return @c _viwerr_hash(3) of the copied string.
+ *
+ */
+uint64_t
+_viwerr_hash_copy(
+        char * buffer,
+        const char * string,
+        size_t size
+);
+
+/**
+ * @fn @c _viwerr_intern_hashed(4)
+ *
+ *      @brief @c _viwerr_intern(3) for a string whose
+ *      @b length & @b hash were already computed by
+ *      @c _viwerr_hash(3).
+ *
+ */
+unsigned
+_viwerr_intern_hashed(
+        const char * string,
+        size_t length,
+        uint64_t hash,
+        bool insert
+);
+
+/**
+ * @fn @c _viwerr_intern(3)
+ *
+ *      @brief Look up a string in the intern table & add it
+ *      if it is not there yet. Only the first @b size - 1
+ *      characters are used, same as the slot buffers would.
+ *      NULL is treated as an empty string.
+ *
+ *
+ *      @param @b string
+ *                String to intern.
+ *
+ *      @param @b size
+ *                Size of the field the string belongs to,
+ *                VIWERR_NAME_SIZE, VIWERR_GROUP_SIZE...
+ *
+ *      @param @b insert
+ *                If false the string is only looked up.
+ *
+ *
+ *      @return Id of the string, 0 if it is not in the table
+ *      and could not (or should not) be added.
+ *
+ */
+unsigned
+_viwerr_intern(
+        const char * string,
+        size_t size,
+        bool insert
+);
+
+/**
+ * @fn @c _viwerr_intern_string(1)
+ *
+ *      @brief Interned string that belongs to @b id.
+ *
+ *
+ *      @return Stable pointer to the string, valid until
+ *      the program exits.
+ *
+ */
+const char *
+_viwerr_intern_string(
+        unsigned id
+);
+
+/**
+ * @fn @c _viwerr_intern_store(5)
+ *
+ *      @brief Intern @b string or copy it into @b buffer
+ *      if the intern table is full.
+ *
+ *
+ *      @param @b id
+ *                Set to the id of the string or to 0 if the
+ *                string was copied.
+ *
+ *      @param @b hash
+ *                Set to the @c _viwerr_hash(3) of the string.
+ *
+ *      @param @b buffer & @b size
+ *                Fallback buffer of the slot, see
+ *                @c _viwerr_buffers.
+ *
+ *
+ *      @return Pointer the package should point to.
+ *
+ */
+char *
+_viwerr_intern_store(
+        unsigned * id,
+        uint64_t * hash,
+        const char * string,
+        char * buffer,
+        size_t size
+);
+
+/**
+ * \ingroup Filter_Sizes
+ * @brief
+ * Most codes & groups a single @c viwerr_filter can
+ * match, any one of them is enough for a package to pass.
+ * @{
+ */
+#define VIWERR_FILTER_CODES  (size_t)8
+#define VIWERR_FILTER_GROUPS (size_t)8
+/**
+ * @}
+ */
+
+/**
+ * @struct  @c viwerr_filter_st
+ * @typedef @c viwerr_filter
+ *
+ *      @brief Filter compiled once by @c viwerr_filter_compile(3)
+ *      and passed to viwerr(...) with @c VIWERR_BY_FILTER as
+ *      many times as needed. Holds the intern ids & hashes of
+ *      its strings so filtering does not hash anything, a
+ *      package passes if its code is in @b code, its group in
+ *      @b group and its name & message equal @b name & @b message,
+ *      each only if the matching VIWERR_BY... bit is in @b arg.
+ *
+ *      The strings are not copied, ones that could not be
+ *      interned must outlive the filter.
+ *
+ *      viwerr(...) compiles a filter of its own for every call
+ *      with a VIWERR_BY... argument and a @c viwerr_package.
+ *
+ */
+typedef struct viwerr_filter_st {
+
+        int             arg;
+
+        size_t          codes;
+        int             code[VIWERR_FILTER_CODES];
+
+        const char     *name;
+        unsigned        name_id;
+        uint64_t        name_hash;
+
+        const char     *message;
+        uint64_t        message_hash;
+
+        size_t          groups;
+        const char     *group[VIWERR_FILTER_GROUPS];
+        unsigned        group_id[VIWERR_FILTER_GROUPS];
+        uint64_t        group_hash[VIWERR_FILTER_GROUPS];
+
+} viwerr_filter;
+
+/**
+ * @fn @c viwerr_filter_compile(3)
+ *
+ *      @brief Compile @b package into @b filter the same way
+ *      viwerr(...) would for @b arg, interning the name & group
+ *      so the filter keeps matching by ids as long as it lives.
+ *      More codes & groups can be added with
+ *      @c viwerr_filter_add_code(2) & @c viwerr_filter_add_group(2).
+ *
+ *
+ *      @param @b filter
+ *                Filter to compile into.
+ *
+ *      @param @b arg
+ *                Arguments from the VIWERR_BY... family, without
+ *                any of them the filter lets every package through.
+ *
+ *      @param @b package
+ *                Values to filter with, can be NULL only if
+ *                @b arg has no VIWERR_BY... argument.
+ *
+ *
+ *      @return false if @b filter or a needed @b package was NULL.
+ *
+ */
+bool
+viwerr_filter_compile(
+        viwerr_filter * filter,
+        int arg,
+        viwerr_package * package
+);
+
+/**
+ * @fn @c viwerr_filter_add_code(2)
+ *
+ *      @brief Let packages with @b code through @b filter
+ *      and turn on its VIWERR_BY_CODE argument.
+ *
+ *
+ *      @return false if @b filter is NULL or already holds
+ *      @c VIWERR_FILTER_CODES codes.
+ *
+ */
+bool
+viwerr_filter_add_code(
+        viwerr_filter * filter,
+        int code
+);
+
+/**
+ * @fn @c viwerr_filter_add_group(2)
+ *
+ *      @brief Let packages of @b group through @b filter
+ *      and turn on its VIWERR_BY_GROUP argument.
+ *
+ *
+ *      @return false if @b filter is NULL or already holds
+ *      @c VIWERR_FILTER_GROUPS groups.
+ *
+ */
+bool
+viwerr_filter_add_group(
+        viwerr_filter * filter,
+        const char * group
+);
+
+/**
+ * @fn @c _viwerr_filter_compile(4)
+ *
+ *      @brief @c viwerr_filter_compile(3) that only interns
+ *      the strings if @b insert is true. viwerr(...) passes false,
+ *      a filter used once should not take up space in the
+ *      intern table.
+ *
+ */
+void
+_viwerr_filter_compile(
+        viwerr_filter * filter,
+        int arg,
+        viwerr_package * package,
+        bool insert
+);
+
+/**
+ * @fn @c _viwerr_filter_by(5)
+ *
+ *      @brief
+ *      Filter a package by the VIWERR_BY... arguments of the
+ *      filter. Names & groups are compared by their intern ids,
+ *      other strings by their hashes first and by strncmp(3)
+ *      only if the hashes are equal.
+ *
+ *
+ *      @param @b ring & @b index
+ *                Slot whose package we will compare/filter
+ *                with our filter.
+ *
+ *      @param @b filter
+ *                Filter compiled with @c _viwerr_filter_compile(4).
+ *
+ *
+ *      @throw Nothing.
+ *
+ *
+ *      @return Integer boolean value of 0 or 1 that will
+ *      tell us if the package passed throught the filter.
+ *
+ *
+ */
+bool
+_viwerr_filter_by(
+        const char * file,
+        int line,
+        _viwerr_ring * ring,
+        size_t index,
+        viwerr_filter * filter
+);
+
+
+/**
+ * @fn @c _viwerr_clear_package(2)
+ *
+ *      @brief Set the package of a slot to that of
+ *      @b viwerr_package_empty and point its strings back at
+ *      the buffers of the slot.
+ *
+ *
+ *      @param @b ring & @b index
+ *                Slot to reset.
+ *
+ *
+ *      @throw Nothing.
+ *
+ *
+ *      @returns Nothing.
+ *
+ */
+void _viwerr_clear_package(
+        _viwerr_ring * ring,
+        size_t index
+);
+
+/**
+ * @brief Prints the contents of a viwerr_package.
+ */
+void
+_viwerr_print_package(
+        viwerr_package * package
+);
+
+/**
+ * @fn @c _viwerr_push(5)
+ *
+ *      @brief Push a copy of @b package into the ring, see
+ *      @c VIWERR_PUSH. @b arg carries the flags that change
+ *      how it is stored (@c VIWERR_STATIC...).
+ *
+ *      @return @b package or NULL if it was NULL.
+ *
+ */
+viwerr_package*
+_viwerr_push(
+        int          arg,
+        char*        func,
+        const char * file,
+        int          line,
+        viwerr_package * package
+);
+
+/**
+ * @fn @c _viwerr_pop_filter(5)
+ *
+ *      @brief Return the newest package that was not
+ *      returned yet & passes @b filter, see @c VIWERR_POP,
+ *      @c VIWERR_PRINT & @c VIWERR_OCCURED, one of which is
+ *      in @b arg.
+ *
+ *      @param @b filter
+ *                Compiled with @c viwerr_filter_compile(3),
+ *                NULL for every package.
+ *
+ *
+ *      @return The package, NULL if none passed. It stays
+ *      valid until the next call of the calling thread, the
+ *      thread safe build copies it (& the strings it holds in
+ *      the ring) into storage of the calling thread before the
+ *      lock is released.
+ *
+ */
+viwerr_package*
+_viwerr_pop_filter(
+        int             arg,
+        char*           func,
+        const char *    file,
+        int             line,
+        viwerr_filter * filter
+);
+
+/**
+ * @fn @c _viwerr_pop(5)
+ *
+ *      @brief @c _viwerr_pop_filter(5) with the filter
+ *      compiled from @b package & the VIWERR_BY... family
+ *      in @b arg, NULL without them.
+ *
+ */
+viwerr_package*
+_viwerr_pop(
+        int              arg,
+        char*            func,
+        const char *     file,
+        int              line,
+        viwerr_package * package
+);
+
+/**
+ * @fn @c _viwerr_flush_filter(5)
+ *
+ *      @brief Flush the packages that pass @b filter, all
+ *      of them if it is NULL, see @c VIWERR_FLUSH.
+ *
+ */
+void
+_viwerr_flush_filter(
+        int             arg,
+        char*           func,
+        const char *    file,
+        int             line,
+        viwerr_filter * filter
+);
+
+/**
+ * @fn @c _viwerr_flush(5)
+ *
+ *      @brief @c _viwerr_flush_filter(5) with the filter
+ *      compiled from @b package, like @c _viwerr_pop(5).
+ *
+ */
+void
+_viwerr_flush(
+        int              arg,
+        char*            func,
+        const char *     file,
+        int              line,
+        viwerr_package * package
+);
+
+#ifdef VIWERR_INBOX
+/**
+ * @fn @c _viwerr_push_unlocked(5),
+ *     @c _viwerr_pop_filter_unlocked(5) &
+ *     @c _viwerr_flush_filter_unlocked(5)
+ *
+ *      @brief The calls above of the single threaded build.
+ *      The thread safe @c _viwerr_push(5) pushes into the
+ *      inbox, the others call these with the lock held.
+ *
+ */
+viwerr_package*
+_viwerr_push_unlocked(
+        int          arg,
+        char*        func,
+        const char * file,
+        int          line,
+        viwerr_package * package
+);
+
+viwerr_package*
+_viwerr_pop_filter_unlocked(
+        int             arg,
+        char*           func,
+        const char *    file,
+        int             line,
+        viwerr_filter * filter
+);
+
+void
+_viwerr_flush_filter_unlocked(
+        int             arg,
+        char*           func,
+        const char *    file,
+        int             line,
+        viwerr_filter * filter
+);
+#endif
+
+/**
+ * @fn @c _viwerr_list_invalid(3)
+ *
+ *      @brief Print why @b arg does not hold exactly one of
+ *      @c VIWERR_PUSH, @c VIWERR_POP, @c VIWERR_PRINT,
+ *      @c VIWERR_FLUSH & @c VIWERR_OCCURED.
+ *
+ *      @return NULL.
+ *
+ */
+#ifdef __GNUC__
+__attribute__((cold))
+#endif
+viwerr_package*
+_viwerr_list_invalid(
+        int          arg,
+        const char * file,
+        int          line
+);
+
+/**
+ * @def @a VIWERR_OPERATIONS
+ *
+ *      @brief The arguments of @a viwerr(2) that cannot
+ *      coexist, exactly one of them is needed per call.
+ *
+ */
+#define VIWERR_OPERATIONS   \
+        (VIWERR_PUSH        \
+        |VIWERR_POP         \
+        |VIWERR_PRINT       \
+        |VIWERR_FLUSH       \
+        |VIWERR_OCCURED)
+
+/**
+ * @def @a VIWERR_BY_PACKAGE
+ *
+ *      @brief The VIWERR_BY... family that filters with a
+ *      package, @c VIWERR_BY_FILTER takes a compiled filter.
+ *
+ */
+#define VIWERR_BY_PACKAGE   \
+        (VIWERR_BY_CODE     \
+        |VIWERR_BY_NAME     \
+        |VIWERR_BY_MESSAGE  \
+        |VIWERR_BY_GROUP)
+
+/**
+ * @def @a VIWERR_ONE_OPERATION(1)
+ *
+ *      @brief True if @b arg holds exactly one of
+ *      @c VIWERR_OPERATIONS.
+ *
+ */
+#define VIWERR_ONE_OPERATION(arg)                               \
+        (((arg) & VIWERR_OPERATIONS) != 0                       \
+        && (((arg) & VIWERR_OPERATIONS)                         \
+          & (((arg) & VIWERR_OPERATIONS) - 1)) == 0)
+
+/**
+ * @def @a VIWERR_STATIC_ASSERT(2)
+ *
+ *      @brief An expression that does not compile unless
+ *      @b cond is a constant & true, the compiler error
+ *      names @b name. _Static_assert from C11 on,
+ *      static_assert in C++11 & a bit field of negative
+ *      width before them.
+ *
+ */
+#if defined(__cplusplus) && __cplusplus >= 201103L
+#define VIWERR_STATIC_ASSERT(cond, name) \
+        ([]{ static_assert((cond), #name); }())
+#elif defined(__cplusplus)
+#define VIWERR_STATIC_ASSERT(cond, name) \
+        ((void)sizeof(char[(cond) ? 1 : -1]))
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define VIWERR_STATIC_ASSERT(cond, name) \
+        ((void)sizeof(struct { int _viwerr; _Static_assert((cond), #name); }))
+#else
+#define VIWERR_STATIC_ASSERT(cond, name) \
+        ((void)sizeof(struct { unsigned name : (cond) ? 1 : -1; }))
+#endif
+
+/**
+ * @fn @c _viwerr_list(5)
+ *
+ *      @brief
+ *      Sort of interface function through which we interact
+ *      with the error package array, calls the one of
+ *      @c _viwerr_push(5), @c _viwerr_pop(5) &
+ *      @c _viwerr_flush(5) @b arg asks for. @b arg is a
+ *      constant in every @a viwerr(2) so the choice folds
+ *      away & only the direct call is left, an @b arg
+ *      without exactly one operation is a compile error
+ *      there. Only @a viwerr_file(4) can reach
+ *      @c _viwerr_list_invalid(3).
+ *
+ *      @param @b arg
+ *                Arguments passed through that will indicate
+ *                what we want to do to the list.
+ *                Possible arguments are:
+ *                      Only one of the following arguments are allowed
+ *                      per call.
+ *                VIWERR_PUSH, VIWERR_POP, VIWERR_PRINT,
+ *                VIWERR_OCCURED & VIWERR_FLUSH.
+ *                      The rest only matter if the prior arguments say
+ *                      that they do.
+ *
+ *      @param @b pointer
+ *                The package to push or filter with.
+ *
+ */
+static inline viwerr_package*
+_viwerr_list(
+        int          arg,
+        char*        func,
+        const char * file,
+        int          line,
+        void *       pointer )
+{
+
+        int operation = arg & VIWERR_OPERATIONS;
+
+        if( operation == VIWERR_PUSH ) {
+                return _viwerr_push(
+                        arg, func, file, line, (viwerr_package*)pointer
+                );
+        }
+
+        if( operation == VIWERR_POP
+        ||  operation == VIWERR_PRINT
+        ||  operation == VIWERR_OCCURED ) {
+                if( arg & VIWERR_BY_FILTER ) {
+                        return _viwerr_pop_filter(
+                                arg, func, file, line,
+                                (viwerr_filter*)pointer
+                        );
+                }
+                return _viwerr_pop(
+                        arg, func, file, line, (viwerr_package*)pointer
+                );
+        }
+
+        if( operation == VIWERR_FLUSH ) {
+                if( arg & VIWERR_BY_FILTER ) {
+                        _viwerr_flush_filter(
+                                arg, func, file, line,
+                                (viwerr_filter*)pointer
+                        );
+                } else {
+                        _viwerr_flush(
+                                arg, func, file, line,
+                                (viwerr_package*)pointer
+                        );
+                }
+                return NULL;
+        }
+
+        return _viwerr_list_invalid(arg, file, line);
+
+}
+
+/**
+ * @def @a viwerr(2)
+ *
+ *      @brief @c _viwerr_list(5) with the package or filter
+ *      pointer passed as the variadic arguments, so the
+ *      commas of a compound literal do not split it. Also
+ *      automatically inserts the __FILE__ and __LINE__ into
+ *      file and line arguments. @b arg has to be a constant
+ *      with exactly one operation, checked at compile time.
+ *
+ */
+#define viwerr(arg, ...)                             \
+        (VIWERR_STATIC_ASSERT(                       \
+                VIWERR_ONE_OPERATION(arg),           \
+                viwerr_needs_exactly_one_operation), \
+        _viwerr_list(                                \
+                (arg)|VIWERR_STATIC_LOCATION,        \
+                (char*)__func__,                     \
+                __FILE__,                            \
+                __LINE__,                            \
+                (void*)(__VA_ARGS__)))
+
+/**
+ * @def @a viwerr_file(4)
+ *
+ *      @brief viwerr_file(4) is viwerr(2) with file and line
+ *      being insertable. @b arg may be computed at run time,
+ *      it is checked then.
+ *
+ */
+#define viwerr_file(arg, func, file, line, ...)  \
+        _viwerr_list(                            \
+                arg,                             \
+                (char*)func,                     \
+                file,                            \
+                line,                            \
+                (void*)(__VA_ARGS__))
+
+/**
+ * @fn @c viwerr_push_file(5), @c viwerr_pop_file(5),
+ *     @c viwerr_occured_file(5) & @c viwerr_flush_file(5)
+ *
+ *      @brief The typed calls @a viwerr_file(4) ends up in,
+ *      with the operation left out of @b arg:
+ *
+ *      viwerr_file(VIWERR_POP|VIWERR_BY_CODE, f, l, n, &package)
+ *      is viwerr_pop_file(VIWERR_BY_CODE, f, l, n, &package).
+ *
+ *      @param @b arg
+ *                The flags that go with the operation, 0 for
+ *                none. Another operation & @c VIWERR_BY_FILTER
+ *                are dropped from it.
+ *
+ *      @param @b package
+ *                Pushed, or what the VIWERR_BY... family in
+ *                @b arg filters with.
+ *
+ */
+static inline viwerr_package*
+viwerr_push_file(
+        int              arg,
+        const char *     func,
+        const char *     file,
+        int              line,
+        viwerr_package * package )
+{
+
+        return _viwerr_push(
+                (arg & ~(VIWERR_OPERATIONS|VIWERR_BY_FILTER))|VIWERR_PUSH,
+                (char*)func, file, line, package
+        );
+
+}
+
+static inline viwerr_package*
+viwerr_pop_file(
+        int              arg,
+        const char *     func,
+        const char *     file,
+        int              line,
+        viwerr_package * package )
+{
+
+        return _viwerr_pop(
+                (arg & ~(VIWERR_OPERATIONS|VIWERR_BY_FILTER))|VIWERR_POP,
+                (char*)func, file, line, package
+        );
+
+}
+
+static inline viwerr_package*
+viwerr_occured_file(
+        int              arg,
+        const char *     func,
+        const char *     file,
+        int              line,
+        viwerr_package * package )
+{
+
+        return _viwerr_pop(
+                (arg & ~(VIWERR_OPERATIONS|VIWERR_BY_FILTER))|VIWERR_OCCURED,
+                (char*)func, file, line, package
+        );
+
+}
+
+static inline void
+viwerr_flush_file(
+        int              arg,
+        const char *     func,
+        const char *     file,
+        int              line,
+        viwerr_package * package )
+{
+
+        _viwerr_flush(
+                (arg & ~(VIWERR_OPERATIONS|VIWERR_BY_FILTER))|VIWERR_FLUSH,
+                (char*)func, file, line, package
+        );
+
+}
+
+/**
+ * @fn @c viwerr_pop_filter_file(5),
+ *     @c viwerr_occured_filter_file(5) &
+ *     @c viwerr_flush_filter_file(5)
+ *
+ *      @brief Same as the calls above but with a compiled
+ *      @c viwerr_filter, they add @c VIWERR_BY_FILTER and drop
+ *      the rest of the VIWERR_BY... family, the filter has
+ *      those.
+ *
+ */
+static inline viwerr_package*
+viwerr_pop_filter_file(
+        int              arg,
+        const char *     func,
+        const char *     file,
+        int              line,
+        viwerr_filter *  filter )
+{
+
+        return _viwerr_pop_filter(
+                (arg & ~(VIWERR_OPERATIONS|VIWERR_BY_PACKAGE))|VIWERR_POP|VIWERR_BY_FILTER,
+                (char*)func, file, line, filter
+        );
+
+}
+
+static inline viwerr_package*
+viwerr_occured_filter_file(
+        int              arg,
+        const char *     func,
+        const char *     file,
+        int              line,
+        viwerr_filter *  filter )
+{
+
+        return _viwerr_pop_filter(
+                (arg & ~(VIWERR_OPERATIONS|VIWERR_BY_PACKAGE))|VIWERR_OCCURED|VIWERR_BY_FILTER,
+                (char*)func, file, line, filter
+        );
+
+}
+
+static inline void
+viwerr_flush_filter_file(
+        int              arg,
+        const char *     func,
+        const char *     file,
+        int              line,
+        viwerr_filter *  filter )
+{
+
+        _viwerr_flush_filter(
+                (arg & ~(VIWERR_OPERATIONS|VIWERR_BY_PACKAGE))|VIWERR_FLUSH|VIWERR_BY_FILTER,
+                (char*)func, file, line, filter
+        );
+
+}
+
+/**
+ * @def @a viwerr_push(2), @a viwerr_pop(2),
+ *      @a viwerr_occured(2) & @a viwerr_flush(2)
+ *
+ *      @brief The calls above with the call site filled in,
+ *      same as @a viwerr(2) with the operation left out of
+ *      @b arg:
+ *
+ *      viwerr(VIWERR_PUSH|VIWERR_STATIC, &package)
+ *      is viwerr_push(VIWERR_STATIC, &package) &
+ *      viwerr(VIWERR_POP|VIWERR_BY_CODE, &package)
+ *      is viwerr_pop(VIWERR_BY_CODE, &package).
+ *
+ *      @param @b arg
+ *                The flags that go with the operation, 0 for
+ *                none. A constant without an operation of its
+ *                own or @c VIWERR_BY_FILTER, checked at compile
+ *                time.
+ *
+ */
+#define viwerr_push(arg, ...)                                        \
+        (VIWERR_STATIC_ASSERT(                                       \
+                ((arg) & (VIWERR_OPERATIONS|VIWERR_BY_FILTER)) == 0, \
+                viwerr_push_takes_no_operation_or_by_filter),        \
+        viwerr_push_file(                                            \
+                (arg)|VIWERR_STATIC_LOCATION,                        \
+                __func__, __FILE__, __LINE__,                        \
+                (__VA_ARGS__)))
+
+#define viwerr_pop(arg, ...)                                         \
+        (VIWERR_STATIC_ASSERT(                                       \
+                ((arg) & (VIWERR_OPERATIONS|VIWERR_BY_FILTER)) == 0, \
+                viwerr_pop_takes_no_operation_or_by_filter),         \
+        viwerr_pop_file(                                             \
+                (arg)|VIWERR_STATIC_LOCATION,                        \
+                __func__, __FILE__, __LINE__,                        \
+                (__VA_ARGS__)))
+
+#define viwerr_occured(arg, ...)                                     \
+        (VIWERR_STATIC_ASSERT(                                       \
+                ((arg) & (VIWERR_OPERATIONS|VIWERR_BY_FILTER)) == 0, \
+                viwerr_occured_takes_no_operation_or_by_filter),     \
+        viwerr_occured_file(                                         \
+                (arg)|VIWERR_STATIC_LOCATION,                        \
+                __func__, __FILE__, __LINE__,                        \
+                (__VA_ARGS__)))
+
+#define viwerr_flush(arg, ...)                                       \
+        (VIWERR_STATIC_ASSERT(                                       \
+                ((arg) & (VIWERR_OPERATIONS|VIWERR_BY_FILTER)) == 0, \
+                viwerr_flush_takes_no_operation_or_by_filter),       \
+        viwerr_flush_file(                                           \
+                (arg)|VIWERR_STATIC_LOCATION,                        \
+                __func__, __FILE__, __LINE__,                        \
+                (__VA_ARGS__)))
+
+/**
+ * @def @a viwerr_pop_filter(2), @a viwerr_occured_filter(2)
+ *      & @a viwerr_flush_filter(2)
+ *
+ *      @brief The filter calls above with the call site filled
+ *      in:
+ *
+ *      viwerr(VIWERR_POP|VIWERR_BY_FILTER, &filter)
+ *      is viwerr_pop_filter(0, &filter).
+ *
+ *      @param @b arg
+ *                A constant without an operation of its own or
+ *                one of the rest of the VIWERR_BY... family,
+ *                checked at compile time.
+ *
+ */
+#define viwerr_pop_filter(arg, ...)                                   \
+        (VIWERR_STATIC_ASSERT(                                        \
+                ((arg) & (VIWERR_OPERATIONS|VIWERR_BY_PACKAGE)) == 0, \
+                viwerr_pop_filter_takes_no_operation_or_by_package),  \
+        viwerr_pop_filter_file(                                       \
+                (arg)|VIWERR_STATIC_LOCATION,                         \
+                __func__, __FILE__, __LINE__,                         \
+                (__VA_ARGS__)))
+
+#define viwerr_occured_filter(arg, ...)                                  \
+        (VIWERR_STATIC_ASSERT(                                           \
+                ((arg) & (VIWERR_OPERATIONS|VIWERR_BY_PACKAGE)) == 0,    \
+                viwerr_occured_filter_takes_no_operation_or_by_package), \
+        viwerr_occured_filter_file(                                      \
+                (arg)|VIWERR_STATIC_LOCATION,                            \
+                __func__, __FILE__, __LINE__,                            \
+                (__VA_ARGS__)))
+
+#define viwerr_flush_filter(arg, ...)                                  \
+        (VIWERR_STATIC_ASSERT(                                         \
+                ((arg) & (VIWERR_OPERATIONS|VIWERR_BY_PACKAGE)) == 0,  \
+                viwerr_flush_filter_takes_no_operation_or_by_package), \
+        viwerr_flush_filter_file(                                      \
+                (arg)|VIWERR_STATIC_LOCATION,                          \
+                __func__, __FILE__, __LINE__,                          \
+                (__VA_ARGS__)))
+
+/**
+ * @fn @c _viwerr_pop_batch(8)
+ *
+ *      @brief Pop up to @b amount packages that pass @b filter
+ *      into @b packages in one walk of the ring. The packages
+ *      come out in the same order repeated
+ *      viwerr(VIWERR_POP|VIWERR_BY_FILTER, filter) calls would
+ *      return them, newest first, and the ring is left the same
+ *      way. Strings the ring holds are copied into
+ *      @b buffers, so the packages stay valid as long as
+ *      @b buffers does, whatever other threads push.
+ *
+ *
+ *      @param @b arg
+ *                @c VIWERR_POP, or @c VIWERR_PRINT to also print
+ *                every package. @c VIWERR_NO_ERRNO_TRIGGER
+ *                is honored.
+ *
+ *      @param @b filter
+ *                Compiled filter, NULL pops every package.
+ *
+ *      @param @b packages, buffers & amount
+ *                Arrays the packages & their strings are
+ *                copied into and their length.
+ *
+ *
+ *      @return Amount of packages that were popped.
+ *
+ */
+size_t
+_viwerr_pop_batch(
+        int             arg,
+        char*           func,
+        const char *    file,
+        int             line,
+        viwerr_filter * filter,
+        viwerr_package *packages,
+        viwerr_buffers *buffers,
+        size_t          amount
+);
+
+/**
+ * @def @a viwerr_pop_batch(5)
+ *
+ *      @brief @c _viwerr_pop_batch(8) called from here.
+ *
+ *      @param @b viwerr_pop_batch(VIWERR_POP,&filter,packages,buffers,16)
+ *
+ */
+#define viwerr_pop_batch(arg, filter, packages, buffers, amount) \
+        _viwerr_pop_batch(                                       \
+                (arg),                                           \
+                (char*)__func__,                                 \
+                __FILE__,                                        \
+                __LINE__,                                        \
+                (filter),                                        \
+                (packages),                                      \
+                (buffers),                                       \
+                (amount))
+
+/**
+ * @struct  @c viwerr_iter_st
+ * @typedef @c viwerr_iter
+ *
+ *      @brief Cursor over the packages that were not returned
+ *      yet, started by @c viwerr_iter_begin(3) & moved by
+ *      @c viwerr_iter_next(1). Iterating changes nothing in the
+ *      ring. Packages popped or flushed while iterating are
+ *      skipped, pushing or resizing the ring ends the iteration
+ *      in an unspecified state.
+ *
+ */
+typedef struct viwerr_iter_st {
+
+        viwerr_filter * filter;
+        bool            oldest_first;
+        size_t          start;
+        size_t          walked;
+
+} viwerr_iter;
+
+/**
+ * @fn @c viwerr_iter_begin(3)
+ *
+ *      @brief Start @b iter at the newest package, or the oldest
+ *      one if @b oldest_first is true. Newest first is the order
+ *      repeated viwerr(VIWERR_POP, NULL) calls would return the
+ *      packages in.
+ *
+ *
+ *      @param @b filter
+ *                Compiled filter the packages must pass, NULL
+ *                lets every package through. Must live as long
+ *                as @b iter is used.
+ *
+ */
+void
+viwerr_iter_begin(
+        viwerr_iter *   iter,
+        viwerr_filter * filter,
+        bool            oldest_first
+);
+
+/**
+ * @fn @c viwerr_iter_next(1)
+ *
+ *      @brief Move @b iter to the next package that passes
+ *      its filter, skipping empty & returned slots a word of
+ *      the live bitmap at a time.
+ *
+ *
+ *      @return The package, or NULL once every package was
+ *      visited. It stays valid until the next call of the
+ *      calling thread, the thread safe build copies it into
+ *      storage of the calling thread like
+ *      @c _viwerr_pop_filter(5).
+ *
+ */
+viwerr_package *
+viwerr_iter_next(
+        viwerr_iter * iter
+);
+
+/**
+ * @struct  @c viwerr_frame_st
+ * @typedef @c viwerr_frame
+ *
+ *      @brief Position of the ring when a frame was started
+ *      with @c viwerr_frame_begin(0). Frames nest, an inner
+ *      frame must end before the one it was started in.
+ *
+ *      @tparam @b pushed
+ *      Amount of packages pushed before the frame, packages
+ *      with a larger or equal sequence belong to the frame.
+ *
+ *      @tparam @b newest & capacity
+ *      Ring head the ring goes back to when the frame is
+ *      dropped, unless it was resized in the meantime.
+ *
+ *      @tparam @b ended
+ *      Set by @c viwerr_frame_end(2).
+ *
+ */
+typedef struct viwerr_frame_st {
+
+        uint64_t        pushed;
+        size_t          newest;
+        size_t          capacity;
+        bool            ended;
+
+} viwerr_frame;
+
+/**
+ * @fn @c viwerr_frame_begin(0)
+ *
+ *      @brief Mark the current position of the ring.
+ *
+ *      @return The frame, passed to @c viwerr_frame_end(2).
+ *
+ */
+viwerr_frame
+viwerr_frame_begin(
+        void
+);
+
+/**
+ * @fn @c viwerr_frame_end(2)
+ *
+ *      @brief End @b frame. If @b drop is true the packages
+ *      pushed since it began that were not returned yet are
+ *      flushed and the ring head goes back to where it was,
+ *      otherwise they are promoted to the enclosing frame.
+ *      Only the packages of the frame are visited, ending a
+ *      frame that pushed nothing costs the same as any other
+ *      call. In the thread safe build the ring is shared, a
+ *      frame only drops the packages of the thread that ends
+ *      it, which must be the one that began it.
+ *
+ *
+ *      @param @b frame
+ *                Frame from @c viwerr_frame_begin(0), ending it
+ *                twice does nothing.
+ *
+ *      @param @b drop
+ *                Flush (true) or keep (false) its packages.
+ *
+ */
+void
+viwerr_frame_end(
+        viwerr_frame * frame,
+        bool drop
+);
+
+/**
+ * @fn @c _viwerr_frame_cleanup(1)
+ *
+ *      @brief Cleanup of @c VIWERR_FRAME(1), drops the frame if
+ *      it was not ended yet.
+ *
+ */
+void
+_viwerr_frame_cleanup(
+        viwerr_frame * frame
+);
+
+/**
+ * @def @a VIWERR_FRAME(1)
+ *
+ *      @brief Declare a frame called @b name that is dropped
+ *      when it goes out of scope, unless it was ended with
+ *      @c viwerr_frame_end(2) first. Only with compilers that
+ *      support the cleanup attribute.
+ *
+ *      @param @b VIWERR_FRAME(frame); ... viwerr_frame_end(&frame,false);
+ *
+ */
+#ifdef __GNUC__
+#define VIWERR_FRAME(name)                                      \
+        viwerr_frame name                                       \
+        __attribute__((cleanup(_viwerr_frame_cleanup))) =       \
+                viwerr_frame_begin()
+#endif
+
+/**
+ * @fn @c viwerr_threads_walk(3)
+ *
+ *      @brief Call @b func with every package that was not
+ *      returned yet of every thread, oldest first within the
+ *      ring of a thread. Meant for diagnostics, only the
+ *      calling thread & threads that exited can be walked
+ *      safely unless the others do not call viwerr meanwhile.
+ *      Without VIWERR_THREAD_RINGS there is only one ring.
+ *
+ *
+ *      @param @b filter
+ *                Compiled filter the packages must pass, NULL
+ *                lets every package through.
+ *
+ *      @param @b func
+ *                Called with the package & @b data, the walk
+ *                stops once it returns false.
+ *
+ *
+ *      @return Amount of packages @b func was called with.
+ *
+ */
+size_t
+viwerr_threads_walk(
+        viwerr_filter * filter,
+        bool         (* func)(viwerr_package * package, void * data),
+        void *          data
+);
+
+/**
+ * @fn @c viwerr_threads_merge(0)
+ *
+ *      @brief Push the packages of the threads that exited
+ *      into the ring of the calling thread, oldest first, &
+ *      release their rings. Without VIWERR_THREAD_RINGS there
+ *      is nothing to merge.
+ *
+ *
+ *      @return Amount of packages pushed.
+ *
+ */
+size_t
+viwerr_threads_merge(
+        void
+);
+
+#ifdef VIWERR_THREAD_RINGS
+/**
+ * @fn @c _viwerr_threads_register(1)
+ *
+ *      @brief Give @b ring, the ring of the calling thread
+ *      that is about to be allocated, the capacity set by the
+ *      last @c viwerr_configure(1) & add it to the rings
+ *      @c viwerr_threads_walk(3) visits. Once the thread exits
+ *      its ring is kept until merged, or released if empty.
+ *
+ */
+void
+_viwerr_threads_register(
+        _viwerr_ring * ring
+);
+
+/**
+ * @fn @c _viwerr_threads_configure(2)
+ *
+ *      @brief Capacity of the rings of threads that did not
+ *      push yet.
+ *
+ */
+void
+_viwerr_threads_configure(
+        size_t capacity,
+        size_t max_capacity
+);
+#endif
+
+#define VIWERR_ERRNO_FLUSH
+
+/**
+ * @fn @c viwerr_errno_redefine(2)
+ *
+ *      @brief This function allows viwerr to be updated
+ *      on the state of errno every time errno is called.
+ *      Due to the C preprocessor reading files line by line,
+ *      the errno calls inside this function are of the orginal
+ *      errno from <errno.h>. Afterwards errno is redefined
+ *      to call this function instead of whatever was
+ *      inside of errno before. Due to this function returning the
+ *      original errno macro, we can use the normal errno
+ *      syntax to read and write values to errno.
+ *      viwerr is kind of late to the party when it comes to
+ *      reading values from errno because we can't make a macro
+ *      that keeps the original syntax and also calls a function
+ *      after the errno value was called for
+ *      reading or writing. Because of that
+ *      viwerr is one read behind errno, which means if errno
+ *      is changed viwerr won't be notified until errno is called
+ *      again. This can be easily mitigated by calling this
+ *      function inside of viwerr but the problem lies not in
+ *      the latency but in the fact that we cannot determine
+ *      on any call to errno wether the value was written to or
+ *      read from. Because of that if we have multiple functions
+ *      setting errno to the same value we will only store the
+ *      errno value from the first function that set it to that
+ *      particular value. In the thread safe build the last
+ *      value seen is kept per thread, like errno itself.
+ *
+ *      @returns &(errno) <- errno before it was redefined.
+ *
+ */
+int * viwerr_errno_redefine(
+        char*        func,
+        const char * file,
+        int line
+);
+
+/**
+ * @struct  @c _viwerr_errno_state_st
+ * @typedef @c _viwerr_errno_state
+ *
+ *      @brief Last value of errno viwerr saw & where it was
+ *      seen, the location is the one a package gets once
+ *      errno changes. Per thread in the thread safe build.
+ *
+ */
+typedef struct _viwerr_errno_state_st {
+
+        int     code;
+        int     line;
+        char   *func;
+        char   *file;
+
+} _viwerr_errno_state;
+
+extern VIWERR_THREAD_LOCAL _viwerr_errno_state _viwerr_errno_previous;
+
+/**
+ * @brief
+ * If viwerr(VIWERR_PUSH, ...) pushed a errno value
+ * viwerr_errno_redefine will ignore the new value as
+ * it is already written. Per thread in the thread safe
+ * build.
+ */
+bool viwerr_errno_ignore_new(bool set);
+
+/**
+ * @fn @c _viwerr_errno_hook(3)
+ *
+ *      @brief What the redefined errno calls. While errno
+ *      keeps the value viwerr saw last only the location is
+ *      updated, inline. Only a changed errno goes through
+ *      @c viwerr_errno_redefine(3).
+ *
+ *      @returns &(errno) <- errno before it was redefined.
+ *
+ */
+static inline int *
+_viwerr_errno_hook(
+        char*        func,
+        const char * file,
+        int          line )
+{
+
+        if( errno != _viwerr_errno_previous.code ) {
+                return viwerr_errno_redefine(func, file, line);
+        }
+
+        _viwerr_errno_previous.func = func;
+        _viwerr_errno_previous.file = (char*)file;
+        _viwerr_errno_previous.line = line;
+        return &errno;
+
+}
+
+/**
+ * @brief
+ * Set by @c viwerr_errno_explicit(1).
+ */
+extern bool _viwerr_errno_explicit;
+
+/**
+ * @fn @c viwerr_errno_explicit(1)
+ *
+ *      @brief If @b set is true viwerr(...) & the other calls
+ *      no longer check errno for changes, only
+ *      @c viwerr_errno_checkpoint(0) & the redefined errno
+ *      itself do. Applies to every thread, set it before
+ *      starting any. Leaves the settings of
+ *      @c viwerr_configure(1) alone.
+ *
+ *      @return The previous value.
+ *
+ */
+bool
+viwerr_errno_explicit(
+        bool set
+);
+
+/**
+ * @fn @c _viwerr_errno_trigger(4)
+ *
+ *      @brief Check errno for changes on entering a viwerr
+ *      call, unless @b arg holds VIWERR_NO_ERRNO_TRIGGER or
+ *      errno is only checked at checkpoints. Inline, an
+ *      unchanged errno costs no call.
+ *
+ */
+static inline void
+_viwerr_errno_trigger(
+        int          arg,
+        char*        func,
+        const char * file,
+        int          line )
+{
+
+#ifdef VIWERR_SUBSCRIPTION_ERRNO
+        if( !(arg & VIWERR_NO_ERRNO_TRIGGER)
+        &&  _viwerr_errno_explicit != true ) {
+                _viwerr_errno_hook(func, file, line);
+        }
+#else
+        (void)arg; (void)func; (void)file; (void)line;
+#endif
+
+}
+
+/**
+ * @def @a viwerr_errno_checkpoint(0)
+ *
+ *      @brief Push the package of errno if it changed since
+ *      viwerr saw it last, the point where errno is harvested
+ *      after @c viwerr_errno_explicit(1) was set.
+ *
+ */
+#define viwerr_errno_checkpoint() \
+        ((void)_viwerr_errno_hook((char*)__func__, __FILE__, __LINE__))
+
+/**
+ * @brief
+ * Tell the compiler which way a branch usually goes.
+ */
+#ifdef __GNUC__
+#define VIWERR_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define VIWERR_UNLIKELY(x) (x)
+#endif
+
+/**
+ * @fn @c _viwerr_check_failed(3)
+ *
+ *      @brief Push the package of errno for a call that just
+ *      failed at @b func, @b file & @b line. errno keeps its
+ *      value & the errno hook counts it as seen so the
+ *      failure is not pushed twice.
+ *
+ *      @return Always true, see @c VIWERR_CHECK(2).
+ *
+ */
+#ifdef __GNUC__
+__attribute__((cold))
+#endif
+bool
+_viwerr_check_failed(
+        char*        func,
+        const char * file,
+        int          line
+);
+
+/**
+ * @def @a VIWERR_CHECK(2)
+ *
+ *      @brief Evaluate @b expr & push the package of errno if
+ *      the result followed by @b failcond is true. The
+ *      failure branch is marked unlikely, when the call
+ *      succeeds only the call & one branch are left. Does not
+ *      need the redefined errno, see REMOVE_ERRNO_REDEFINE.
+ *
+ *      @param @b if( VIWERR_CHECK(fd = open(path, O_RDONLY), == -1) ) ...
+ *
+ *      @return true if the call failed.
+ *
+ */
+#define VIWERR_CHECK(expr, failcond)                            \
+        (VIWERR_UNLIKELY((expr) failcond) ?                     \
+                _viwerr_check_failed(                           \
+                        (char*)__func__, __FILE__, __LINE__) :  \
+                false)
+
+/**
+ * @def @a VIWERR_CHECK_MINUS_ONE(1) & VIWERR_CHECK_NULL(1)
+ *
+ *      @brief @c VIWERR_CHECK(2) for calls that fail with -1
+ *      (open(2), read(2)...) & calls that fail with NULL
+ *      (malloc(3), fopen(3)...).
+ *
+ */
+#define VIWERR_CHECK_MINUS_ONE(expr) VIWERR_CHECK(expr, == -1)
+#define VIWERR_CHECK_NULL(expr)      VIWERR_CHECK(expr, == NULL)
+
+
+/**
+ * @fn @c _viwerr_occured_in_group(4)
+ *
+ *      @brief Check if a package of group @b group was pushed
+ *      & not returned yet by reading the per group counter of
+ *      the ring. Only if packages whose group is not interned
+ *      are pending does it fall back to a filtered
+ *      VIWERR_OCCURED.
+ *
+ *      @returns true if such a package exists.
+ *
+ */
+static inline bool
+_viwerr_occured_in_group(
+        const char * group,
+        char*        func,
+        const char * file,
+        int          line )
+{
+
+        _viwerr_errno_trigger(0, func, file, line);
+
+        VIWERR_LOCK();
+
+        unsigned id = _viwerr_intern(group, VIWERR_GROUP_SIZE, false);
+
+        _viwerr_ring * ring = &_viwerr_ring_global;
+        bool occured;
+
+        if( id != 0
+        &&  ring->group_epoch[id] == ring->epoch
+        &&  ring->group_count[id] != 0 ) {
+                occured = true;
+        } else if( ring->group_epoch[0] != ring->epoch
+               ||  ring->group_count[0] == 0 ) {
+                occured = false;
+        } else {
+                /**
+                 * @brief
+                 * A named package instead of a compound literal,
+                 * C++ can not take the address of one.
+                 */
+                viwerr_package package;
+                memset(&package, 0, sizeof(package));
+                package.group = (char*)group;
+                occured = _viwerr_pop(
+                        VIWERR_OCCURED|VIWERR_BY_GROUP|VIWERR_NO_ERRNO_TRIGGER,
+                        func, file, line, &package
+                ) != NULL;
+        }
+
+        VIWERR_UNLOCK();
+        return occured;
+
+}
+
+/**
+ * @def @a viwerr_occured_in_group(1)
+ *
+ *      @brief Check if a package of group @b gr is pending,
+ *      see @c _viwerr_occured_in_group(4).
+ *
+ */
+#define viwerr_occured_in_group(gr) \
+        _viwerr_occured_in_group((gr), (char*)__func__, __FILE__, __LINE__)
+
+/* SPDX-License-Identifier: 0BSD */
+/* Copyright 2019 Alexander Kozhevnikov <mentalisttraceur@gmail.com> */
+char const * errnoname(int errno_);
+
+/**
+ * @fn @c _viwerr_errno_message(1)
+ *
+ *      @brief Message of errno code @b errno_ from a static
+ *      table next to the names of @c errnoname(1), pushed
+ *      by pointer with @c VIWERR_STATIC_MESSAGE.
+ *
+ *      @return The message or NULL if the code is unknown.
+ *
+ */
+char const * _viwerr_errno_message(int errno_);
+
+/**
+ * @fn @c _viwerr_errno_strerror(1)
+ *
+ *      @brief @c strerror_r(3) of @b code for the codes
+ *      @c _viwerr_errno_message(1) does not know, cached per
+ *      thread for the last code asked for.
+ *
+ *      @return A thread local buffer, copy it before the
+ *      next call.
+ *
+ */
+char const * _viwerr_errno_strerror(int code);
+
+/**
+ * @fn @c viwerr_errno_code(1)
+ *
+ *      @brief Reverse of @c errnoname(1), the errno code
+ *      named @b name ("EAGAIN", "ENOENT"...). A perfect hash
+ *      over the names finds it with one hash & one
+ *      @c strcmp(3).
+ *
+ *      @return The code or 0 if the name is unknown or the
+ *      platform does not define it.
+ *
+ */
+int viwerr_errno_code(const char * name);
 
 #ifndef REMOVE_ERRNO_REDEFINE
 #if defined(VIWERR_SUBSCRIPTION_ERRNO) && !defined(VIWERR_REMOVE_FOR_OBJ_COMP)
         #undef errno
-        #define errno (*viwerr_errno_redefine((char*)___func__,__FILE__,__LINE__))
+        #define errno (*_viwerr_errno_hook((char*)__func__,__FILE__,__LINE__))
 #endif /** @c VIWERR_SUBSCRIPTION_ERRNO */
 #endif
 